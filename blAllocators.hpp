@@ -0,0 +1,309 @@
+#ifndef BL_ALLOCATORS_HPP
+#define BL_ALLOCATORS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blAllocators.hpp
+// CLASS:           blAlignedAllocator
+//                  blDefaultInitAllocator
+// BASE CLASS:      None
+//                  blBaseAllocator (std::allocator by default)
+//
+//
+//
+// PURPOSE:         -- The blAlignedAllocator allocates memory aligned to
+//                     a specified alignment (64 bytes by default, which
+//                     is a cache line and an AVX-512 register), so that
+//                     buffers can be processed with aligned vector loads
+//
+//                  -- The default alignment used by the buffers can be
+//                     changed by defining BL_BUFFER_DATA_ALIGNMENT
+//
+//                  -- The blDefaultInitAllocator adapts an allocator so
+//                     that containers using it default initialize their
+//                     elements instead of value initializing them, which
+//                     leaves trivially default constructible elements
+//                     (ints, floats, plain structs) uninitialized
+//
+//                  -- This lets a buffer's data vector grow by gigabytes
+//                     without zeroing every element first, the pages are
+//                     only touched when the data is actually written
+//
+//                  -- Elements of any other type are still value
+//                     initialized, so they behave exactly as they do
+//                     with the adapted allocator
+//
+//                  -- This class is defined within the namespace "blBufferLIB"
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENSE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- std::allocator_traits
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <limits>
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The default alignment of the
+// data owned by the buffers
+//-------------------------------------------------------------------
+#ifndef BL_BUFFER_DATA_ALIGNMENT
+#define BL_BUFFER_DATA_ALIGNMENT 64
+#endif
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blAlignedAllocator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blAlignment = BL_BUFFER_DATA_ALIGNMENT>
+
+class blAlignedAllocator
+{
+public: // Public typedefs
+
+    using value_type = blDataType;
+
+
+
+    // The alignment can't be smaller
+    // than the data type's own
+
+    static constexpr std::size_t alignment = (blAlignment > alignof(blDataType) ? blAlignment : alignof(blDataType));
+
+    static_assert((alignment & (alignment - 1)) == 0,"blAlignedAllocator needs a power of two alignment");
+
+
+
+    template<typename blOtherDataType>
+    struct rebind
+    {
+        using other = blAlignedAllocator<blOtherDataType,blAlignment>;
+    };
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blAlignedAllocator() = default;
+
+
+
+    // Constructor from another
+    // blAlignedAllocator
+
+    template<typename blOtherDataType>
+    blAlignedAllocator(const blAlignedAllocator<blOtherDataType,blAlignment>&) noexcept
+    {
+    }
+
+public: // Public functions
+
+    // Functions used to allocate
+    // and deallocate aligned memory
+
+    blDataType*                                             allocate(const std::size_t& numberOfDataPoints)
+    {
+        if(numberOfDataPoints > std::numeric_limits<std::size_t>::max() / sizeof(blDataType))
+            throw std::bad_array_new_length();
+
+        return static_cast<blDataType*>(::operator new(numberOfDataPoints * sizeof(blDataType),std::align_val_t(alignment)));
+    }
+
+    void                                                    deallocate(blDataType* data,const std::size_t& numberOfDataPoints)noexcept
+    {
+        ::operator delete(static_cast<void*>(data),numberOfDataPoints * sizeof(blDataType),std::align_val_t(alignment));
+    }
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Aligned allocators are stateless,
+// so they're all equal when they
+// have the same alignment
+//-------------------------------------------------------------------
+template<typename blDataType1,typename blDataType2,
+         std::size_t blAlignment>
+
+inline bool operator==(const blAlignedAllocator<blDataType1,blAlignment>&,
+                       const blAlignedAllocator<blDataType2,blAlignment>&)
+{
+    return true;
+}
+
+
+
+template<typename blDataType1,typename blDataType2,
+         std::size_t blAlignment>
+
+inline bool operator!=(const blAlignedAllocator<blDataType1,blAlignment>&,
+                       const blAlignedAllocator<blDataType2,blAlignment>&)
+{
+    return false;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blDefaultInitAllocator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blBaseAllocator = std::allocator<blDataType> >
+
+class blDefaultInitAllocator : public blBaseAllocator
+{
+private: // Private typedefs
+
+    using base_traits = std::allocator_traits<blBaseAllocator>;
+
+public: // Public typedefs
+
+    using value_type = blDataType;
+
+
+
+    // The adapted allocator is rebound
+    // along with this one, so containers
+    // allocating their own nodes keep
+    // default initializing them
+
+    template<typename blOtherDataType>
+    struct rebind
+    {
+        using other = blDefaultInitAllocator<blOtherDataType,
+                                             typename base_traits::template rebind_alloc<blOtherDataType> >;
+    };
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blDefaultInitAllocator() = default;
+
+
+
+    // Constructors from an adapted
+    // allocator and from another
+    // blDefaultInitAllocator
+
+    blDefaultInitAllocator(const blBaseAllocator& baseAllocator) noexcept : blBaseAllocator(baseAllocator)
+    {
+    }
+
+    template<typename blOtherDataType,
+             typename blOtherBaseAllocator>
+    blDefaultInitAllocator(const blDefaultInitAllocator<blOtherDataType,blOtherBaseAllocator>& allocator) noexcept : blBaseAllocator(allocator)
+    {
+    }
+
+public: // Public functions
+
+    // Function used to construct an element
+    // without any arguments, which is where
+    // trivially default constructible elements
+    // are left uninitialized
+
+    template<typename blElementType>
+    void                                                    construct(blElementType* element)noexcept(std::is_nothrow_default_constructible<blElementType>::value)
+    {
+        if constexpr(std::is_trivially_default_constructible<blElementType>::value)
+            ::new(static_cast<void*>(element)) blElementType;
+        else
+            base_traits::construct(static_cast<blBaseAllocator&>(*this),element);
+    }
+
+
+
+    // Any other construction is left
+    // to the adapted allocator
+
+    template<typename blElementType,
+             typename blFirstArgumentType,
+             typename...blOtherArgumentTypes>
+    void                                                    construct(blElementType* element,
+                                                                      blFirstArgumentType&& firstArgument,
+                                                                      blOtherArgumentTypes&&... otherArguments)
+    {
+        base_traits::construct(static_cast<blBaseAllocator&>(*this),
+                               element,
+                               std::forward<blFirstArgumentType>(firstArgument),
+                               std::forward<blOtherArgumentTypes>(otherArguments)...);
+    }
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Two adapted allocators are equal
+// if the allocators they adapt are
+//-------------------------------------------------------------------
+template<typename blDataType1,typename blBaseAllocator1,
+         typename blDataType2,typename blBaseAllocator2>
+
+inline bool operator==(const blDefaultInitAllocator<blDataType1,blBaseAllocator1>& allocator1,
+                       const blDefaultInitAllocator<blDataType2,blBaseAllocator2>& allocator2)
+{
+    return static_cast<const blBaseAllocator1&>(allocator1) == static_cast<const blBaseAllocator2&>(allocator2);
+}
+
+
+
+template<typename blDataType1,typename blBaseAllocator1,
+         typename blDataType2,typename blBaseAllocator2>
+
+inline bool operator!=(const blDefaultInitAllocator<blDataType1,blBaseAllocator1>& allocator1,
+                       const blDefaultInitAllocator<blDataType2,blBaseAllocator2>& allocator2)
+{
+    return !(allocator1 == allocator2);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_ALLOCATORS_HPP
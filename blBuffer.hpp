@@ -46,6 +46,11 @@
 //                     as circular-iterators and circular-ROI-iterators that can
 //                     all work with stl-algorithms
 //
+//                  -- The data the buffer owns is allocated with the
+//                     blAllocator template parameter, so that arena, pool
+//                     or NUMA-local allocators can be plugged in (by default
+//                     the data is aligned to BL_BUFFER_DATA_ALIGNMENT bytes)
+//
 //                  -- The buffer and all its functions are defined
 //                     within the blBufferLIB namespace
 //
@@ -95,9 +100,10 @@ namespace blBufferLIB
 
 template<typename blDataType,
          std::size_t blMaxNumOfDimensions,
-         typename blDataPtr = blDataType*>
+         typename blDataPtr = blDataType*,
+         typename blAllocator = blAlignedAllocator<blDataType> >
 
-using blBufferPtrType = blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>*;
+using blBufferPtrType = blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>*;
 
 
 
@@ -106,9 +112,10 @@ using blBufferPtrType = blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>*;
 template<typename blDataType,
          std::size_t blMaxNumOfDimensions,
          typename blDataPtr = blDataType*,
-         typename blBufferPtr = blBufferPtrType<blDataType,blMaxNumOfDimensions,blDataPtr> >
+         typename blBufferPtr = blBufferPtrType<blDataType,blMaxNumOfDimensions,blDataPtr>,
+         typename blAllocator = blAlignedAllocator<blDataType> >
 
-using blBufferRoiPtrType = blBuffer_4<double,blDataPtr,blBufferPtr,blMaxNumOfDimensions>;
+using blBufferRoiPtrType = blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>*;
 
 //-------------------------------------------------------------------
 
@@ -121,9 +128,10 @@ template<typename blDataType,
          std::size_t blMaxNumOfDimensions,
          typename blDataPtr = blDataType*,
          typename blBufferPtr = blBufferPtrType<blDataType,blMaxNumOfDimensions,blDataPtr>,
-         typename blBufferRoiPtr = blBufferRoiPtrType<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr> >
+         typename blBufferRoiPtr = blBufferRoiPtrType<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr>,
+         typename blAllocator = blAlignedAllocator<blDataType> >
 
-class blBuffer : public blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>
+class blBuffer : public blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>
 {
 public: // Constructors and destructors
 
@@ -137,13 +145,40 @@ public: // Constructors and destructors
 
     // Copy constructor
 
-    blBuffer(const blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr>& buffer);
+    blBuffer(const blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>& buffer);
+
+
+
+    // Move constructor (steals the
+    // data in constant time, the
+    // source is left empty)
+
+    blBuffer(blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>&& buffer) noexcept;
 
 
 
     // Destructor
 
     ~blBuffer();
+
+
+
+public: // Overloaded operators
+
+
+
+    // Assignment operator (declared
+    // explicitly, since declaring the
+    // move assignment operator would
+    // otherwise delete it)
+
+    blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>&  operator=(const blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>& buffer) = default;
+
+
+
+    // Move assignment operator
+
+    blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>&  operator=(blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>&& buffer) = default;
 };
 //-------------------------------------------------------------------
 
@@ -154,9 +189,26 @@ template<typename blDataType,
          std::size_t blMaxNumOfDimensions,
          typename blDataPtr,
          typename blBufferPtr,
-         typename blBufferRoiPtr>
+         typename blBufferRoiPtr,
+         typename blAllocator>
+
+inline blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>::blBuffer() : blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>()
+{
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         typename blAllocator>
 
-inline blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr>::blBuffer() : blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>()
+inline blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>::blBuffer(const blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>& buffer)
+                                                                                                            : blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>(buffer)
 {
 }
 //-------------------------------------------------------------------
@@ -168,10 +220,11 @@ template<typename blDataType,
          std::size_t blMaxNumOfDimensions,
          typename blDataPtr,
          typename blBufferPtr,
-         typename blBufferRoiPtr>
+         typename blBufferRoiPtr,
+         typename blAllocator>
 
-inline blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr>::blBuffer(const blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr>& buffer)
-                                                                                                : blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>(buffer)
+inline blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>::blBuffer(blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>&& buffer) noexcept
+                                                                                                            : blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>(std::move(buffer))
 {
 }
 //-------------------------------------------------------------------
@@ -183,15 +236,37 @@ template<typename blDataType,
          std::size_t blMaxNumOfDimensions,
          typename blDataPtr,
          typename blBufferPtr,
-         typename blBufferRoiPtr>
+         typename blBufferRoiPtr,
+         typename blAllocator>
 
-inline blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr>::~blBuffer()
+inline blBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr,blAllocator>::~blBuffer()
 {
 }
 //-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Standard buffer using the specified allocator
+// for its data (the allocator being the last
+// template parameter of blBuffer, the buffer
+// and roi pointer types have to be spelled out
+// to match it)
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+using blBufferWithAllocator = blBuffer<blDataType,
+                                       blMaxNumOfDimensions,
+                                       blDataType*,
+                                       blBufferPtrType<blDataType,blMaxNumOfDimensions,blDataType*,blAllocator>,
+                                       blBufferRoiPtrType<blDataType,blMaxNumOfDimensions,blDataType*,blBufferPtrType<blDataType,blMaxNumOfDimensions,blDataType*,blAllocator>,blAllocator>,
+                                       blAllocator>;
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // End of namespace
 }
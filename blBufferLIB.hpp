@@ -28,6 +28,9 @@
 //-------------------------------------------------------------------
 
 #include "blSharedMemoryBuffer.hpp"
+#include "blPosixSharedMemoryBuffer.hpp"
+#include "blBufferPool.hpp"
+#include "blFixedSizeBuffer.hpp"
 
 //-------------------------------------------------------------------
 
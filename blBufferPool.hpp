@@ -0,0 +1,598 @@
+#ifndef BL_BUFFERPOOL_HPP
+#define BL_BUFFERPOOL_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blBufferPool.hpp
+// CLASS:           blBufferPool
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         -- The blBufferPool class hands out buffers of a given
+//                     shape and takes them back once the user is done with
+//                     them, so that code creating a buffer per frame (or per
+//                     message) reuses the same storage instead of hitting
+//                     the allocator and initializing the data every time
+//
+//                  -- Buffers are handed out as unique pointers that give
+//                     the buffer back to the pool when they're destroyed,
+//                     returned buffers hold whatever data they held when
+//                     they were returned (new buffers are created uninitialized
+//                     as well), everything else is reset, their ROI, their
+//                     ring (registered readers, write sequence, write mode,
+//                     overrun policy and wait strategies) and their options
+//
+//                  -- Returned buffers whose data is padded (because the user
+//                     set a pitch alignment and re-created them) are destroyed
+//                     instead of pooled, since their layout differs from that
+//                     of a new buffer of the same shape, and so are returned
+//                     buffers that don't own their data (because the user
+//                     wrapped external memory with them), since that memory
+//                     could be gone by the time the buffer is handed out again
+//
+//                  -- The pool is thread safe, it's split in shards each
+//                     with its own lock, and every thread acquires and
+//                     returns buffers through the shard its id hashes to,
+//                     only looking at the other shards when its own has
+//                     no buffer of the requested shape
+//
+//                  -- NOTE: The shards are not thread local caches, threads
+//                           whose ids hash to the same shard share it and
+//                           contend for its lock, and with more threads than
+//                           shards some always do
+//
+//                  -- The pool keeps statistics (hit rate, outstanding and
+//                     pooled buffers) that can be read at any time
+//
+//                  -- The pool has to outlive the buffers it hands out
+//
+//                  -- This class is defined within the namespace "blBufferLIB"
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- blBuffer and all its dependencies
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+// The buffers handed out by the pool
+
+#include "blBuffer.hpp"
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// A snapshot of a pool's statistics
+//-------------------------------------------------------------------
+struct blBufferPoolStatistics
+{
+    std::uint64_t                                           m_numberOfAcquisitions = 0;
+    std::uint64_t                                           m_numberOfHits = 0;
+
+    double                                                  m_hitRate = 0;
+
+    std::uint64_t                                           m_numberOfOutstandingBuffers = 0;
+    std::uint64_t                                           m_numberOfPooledBuffers = 0;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blBufferPool declaration
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator = blAlignedAllocator<blDataType> >
+
+class blBufferPool
+{
+public: // Public type aliases
+
+
+
+    // The type of buffers handed
+    // out by the pool
+
+    using buffer_type = blBufferWithAllocator<blDataType,blMaxNumOfDimensions,blAllocator>;
+
+
+
+    // The deleter giving the buffers
+    // back to the pool and the pointers
+    // the buffers are handed out with
+
+    struct deleter
+    {
+        void                                                operator()(buffer_type* buffer)const
+        {
+            if(buffer != nullptr)
+                m_pool->release(buffer);
+        }
+
+        blBufferPool*                                       m_pool = nullptr;
+    };
+
+    using buffer_ptr = std::unique_ptr<buffer_type,deleter>;
+
+
+
+public: // Constructors and destructors
+
+
+
+    // Default constructor
+    //
+    // -- The pool has one shard per hardware
+    //    thread unless specified otherwise
+    //
+    // -- Every shard keeps at most the specified
+    //    number of returned buffers of each shape,
+    //    any more are destroyed
+
+    blBufferPool(const std::size_t& numberOfShards = 0,
+                 const std::size_t& maxNumberOfPooledBuffersPerShape = 64);
+
+
+
+    // The pool can't be copied
+
+    blBufferPool(const blBufferPool& bufferPool) = delete;
+
+
+
+    // Destructor
+
+    ~blBufferPool();
+
+
+
+public: // Overloaded operators
+
+
+
+    // The pool can't be copied
+
+    blBufferPool&                                           operator=(const blBufferPool& bufferPool) = delete;
+
+
+
+public: // Public functions
+
+
+
+    // Functions used to get a buffer
+    // of the specified shape, either
+    // one that was returned to the pool
+    // or a newly created one
+    //
+    // -- The returned pointer is null if
+    //    a new buffer could not be created
+
+    template<typename...blIntegerType>
+    buffer_ptr                                              acquire(const blIntegerType&... bufferLengths);
+
+    buffer_ptr                                              acquire(const std::array<std::size_t,blMaxNumOfDimensions>& bufferLengths);
+
+
+
+    // Function used to destroy all
+    // the buffers held by the pool
+
+    void                                                    clear();
+
+
+
+    // Function used to get a
+    // snapshot of the statistics
+
+    blBufferPoolStatistics                                  statistics()const;
+
+
+
+    // Function used to get the
+    // number of shards
+
+    const std::size_t&                                      numberOfShards()const;
+
+
+
+private: // Private types
+
+
+
+    // The buffers are pooled by shape
+
+    using shape_type = std::array<std::size_t,blMaxNumOfDimensions>;
+
+
+
+    // Each shard holds the returned
+    // buffers of each shape
+
+    struct alignas(blCacheLineSize) shard
+    {
+        std::mutex                                          m_mutex;
+
+        std::map< shape_type,std::vector< std::unique_ptr<buffer_type> > > m_pooledBuffers;
+    };
+
+
+
+private: // Private functions
+
+
+
+    // Function used to give a buffer
+    // back to the pool
+
+    void                                                    release(buffer_type* buffer);
+
+
+
+    // Function used to find the shard
+    // used by the calling thread
+
+    std::size_t                                             indexOfShardOfThisThread()const;
+
+
+
+    // Function used to take a buffer of
+    // the specified shape out of a shard
+
+    std::unique_ptr<buffer_type>                            takeBuffer(shard& bufferShard,
+                                                                       const shape_type& shape);
+
+
+
+private: // Private variables
+
+
+
+    // The shards
+
+    std::unique_ptr<shard[]>                                m_shards;
+
+    std::size_t                                             m_numberOfShards;
+
+    std::size_t                                             m_maxNumberOfPooledBuffersPerShape;
+
+
+
+    // The statistics
+
+    std::atomic<std::uint64_t>                              m_numberOfAcquisitions{0};
+    std::atomic<std::uint64_t>                              m_numberOfHits{0};
+
+    std::atomic<std::uint64_t>                              m_numberOfOutstandingBuffers{0};
+    std::atomic<std::uint64_t>                              m_numberOfPooledBuffers{0};
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Default constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::blBufferPool(const std::size_t& numberOfShards,
+                                                                               const std::size_t& maxNumberOfPooledBuffersPerShape)
+{
+    m_numberOfShards = numberOfShards;
+
+    if(m_numberOfShards == 0)
+        m_numberOfShards = std::max<std::size_t>(1,std::thread::hardware_concurrency());
+
+    m_shards.reset(new shard[m_numberOfShards]);
+
+    m_maxNumberOfPooledBuffersPerShape = maxNumberOfPooledBuffersPerShape;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::~blBufferPool()
+{
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get a buffer of a specified shape
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename...blIntegerType>
+
+inline typename blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::buffer_ptr blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::acquire(const blIntegerType&... bufferLengths)
+{
+    // The shape is normalized the same
+    // way the buffer's sizes are, the
+    // unspecified sizes being one
+
+    blDimensionalProperties<blMaxNumOfDimensions> properties;
+
+    properties.setDimensionalSizes({static_cast<std::size_t>(bufferLengths)...});
+
+    return acquire(properties.sizes());
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline typename blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::buffer_ptr blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::acquire(const std::array<std::size_t,blMaxNumOfDimensions>& bufferLengths)
+{
+    m_numberOfAcquisitions.fetch_add(1,std::memory_order_relaxed);
+
+
+
+    // We first look in this thread's
+    // shard and then in the others
+
+    std::size_t indexOfFirstShard = indexOfShardOfThisThread();
+
+    for(std::size_t i = 0; i < m_numberOfShards; ++i)
+    {
+        std::unique_ptr<buffer_type> buffer = takeBuffer(m_shards[(indexOfFirstShard + i) % m_numberOfShards],bufferLengths);
+
+        if(buffer)
+        {
+            m_numberOfHits.fetch_add(1,std::memory_order_relaxed);
+            m_numberOfOutstandingBuffers.fetch_add(1,std::memory_order_relaxed);
+
+            return buffer_ptr(buffer.release(),deleter{this});
+        }
+    }
+
+
+
+    // Otherwise we create a new buffer,
+    // whose data is left uninitialized
+    // like that of returned buffers
+
+    std::unique_ptr<buffer_type> buffer(new buffer_type());
+
+    buffer->setInitializationMode(blInitializationMode::UNINITIALIZED);
+
+    if(!buffer->create(bufferLengths))
+        return buffer_ptr(nullptr,deleter{this});
+
+    m_numberOfOutstandingBuffers.fetch_add(1,std::memory_order_relaxed);
+
+    return buffer_ptr(buffer.release(),deleter{this});
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to give a buffer back to the pool
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::release(buffer_type* buffer)
+{
+    std::unique_ptr<buffer_type> returnedBuffer(buffer);
+
+    m_numberOfOutstandingBuffers.fetch_sub(1,std::memory_order_relaxed);
+
+
+
+    // The user could have changed the
+    // buffer's shape, so we pool it by
+    // its current one, unless its data
+    // is padded, isn't its own (it wraps
+    // external memory) or there's none
+
+    if(returnedBuffer->size() == 0 || m_maxNumberOfPooledBuffersPerShape == 0)
+        return;
+
+    if(!returnedBuffer->doesBufferOwnData())
+        return;
+
+    if(returnedBuffer->properties().pitches() != returnedBuffer->properties().sizes())
+        return;
+
+
+
+    // Everything else the user could
+    // have changed is reset so that the
+    // next user gets the buffer just like
+    // a new one, except for its data
+
+    returnedBuffer->resetROI();
+    returnedBuffer->resetRing();
+    returnedBuffer->resetOptions();
+
+    returnedBuffer->setInitializationMode(blInitializationMode::UNINITIALIZED);
+
+
+
+    shard& bufferShard = m_shards[indexOfShardOfThisThread()];
+
+    std::lock_guard<std::mutex> lock(bufferShard.m_mutex);
+
+    auto& pooledBuffers = bufferShard.m_pooledBuffers[returnedBuffer->properties().sizes()];
+
+    if(pooledBuffers.size() < m_maxNumberOfPooledBuffersPerShape)
+    {
+        pooledBuffers.push_back(std::move(returnedBuffer));
+
+        m_numberOfPooledBuffers.fetch_add(1,std::memory_order_relaxed);
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to take a buffer out of a shard
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::unique_ptr<typename blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::buffer_type> blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::takeBuffer(shard& bufferShard,
+                                                                                                                                                                                 const shape_type& shape)
+{
+    std::lock_guard<std::mutex> lock(bufferShard.m_mutex);
+
+    auto pooledBuffers = bufferShard.m_pooledBuffers.find(shape);
+
+    if(pooledBuffers == bufferShard.m_pooledBuffers.end() || pooledBuffers->second.empty())
+        return nullptr;
+
+
+
+    // The most recently returned buffer
+    // is the most likely to be in cache
+
+    std::unique_ptr<buffer_type> buffer = std::move(pooledBuffers->second.back());
+
+    pooledBuffers->second.pop_back();
+
+    m_numberOfPooledBuffers.fetch_sub(1,std::memory_order_relaxed);
+
+    return buffer;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to destroy all the pooled buffers
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::clear()
+{
+    for(std::size_t i = 0; i < m_numberOfShards; ++i)
+    {
+        std::lock_guard<std::mutex> lock(m_shards[i].m_mutex);
+
+        for(auto& pooledBuffers : m_shards[i].m_pooledBuffers)
+            m_numberOfPooledBuffers.fetch_sub(pooledBuffers.second.size(),std::memory_order_relaxed);
+
+        m_shards[i].m_pooledBuffers.clear();
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to get a snapshot of the statistics
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBufferPoolStatistics blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::statistics()const
+{
+    blBufferPoolStatistics statistics;
+
+    statistics.m_numberOfAcquisitions = m_numberOfAcquisitions.load(std::memory_order_relaxed);
+    statistics.m_numberOfHits = m_numberOfHits.load(std::memory_order_relaxed);
+
+    if(statistics.m_numberOfAcquisitions > 0)
+        statistics.m_hitRate = double(statistics.m_numberOfHits) / double(statistics.m_numberOfAcquisitions);
+
+    statistics.m_numberOfOutstandingBuffers = m_numberOfOutstandingBuffers.load(std::memory_order_relaxed);
+    statistics.m_numberOfPooledBuffers = m_numberOfPooledBuffers.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get the shards
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const std::size_t& blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::numberOfShards()const
+{
+    return m_numberOfShards;
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBufferPool<blDataType,blMaxNumOfDimensions,blAllocator>::indexOfShardOfThisThread()const
+{
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) % m_numberOfShards;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_BUFFERPOOL_HPP
@@ -20,6 +20,17 @@
 //                  -- The dimensional lengths are stored in a
 //                     blDimensionalProperties<blMaxNumOfDimensions> structure
 //
+//                  -- The data is normally held in a std::vector using the
+//                     blAllocator template parameter (which aligns the data
+//                     by default), but a buffer can also hold it in mirrored
+//                     memory (mapped twice back to back), in which case the
+//                     buffer's data is followed by a second view of itself,
+//                     or in memory mapped with huge pages
+//
+//                  -- Copying a buffer copies the data it owns into
+//                     the same kind of memory (falling back on the
+//                     std::vector if that memory can't be allocated)
+//
 //                  -- This class is defined within the namespace "blBufferLIB"
 //
 //
@@ -48,6 +59,22 @@
 
 #include "blDimensionalProperties.hpp"
 
+
+
+// Used to allocate the data
+// of mirrored circular buffers
+
+#include "blMirroredMemory.hpp"
+#include "blMappedMemory.hpp"
+
+
+
+// Used to align the data vector
+// and let it grow without
+// initializing trivial data types
+
+#include "blAllocators.hpp"
+
 //-------------------------------------------------------------------
 
 
@@ -65,10 +92,42 @@ namespace blBufferLIB
 // class blBuffer_0 declaration
 //-------------------------------------------------------------------
 template<typename blDataType,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 class blBuffer_0
 {
+public: // Public type aliases
+
+
+
+    // The allocator used by the data
+    // vector (the user's allocator
+    // rebound to the data type)
+
+    using allocator_type = typename std::allocator_traits<blAllocator>::template rebind_alloc<blDataType>;
+
+
+
+public: // Public variables
+
+
+
+    // Whether moving a buffer into another
+    // one can't throw, which is the case
+    // unless the data's allocator is stateful
+    // and stays with its buffer (it doesn't
+    // propagate on move assignment and its
+    // instances can compare unequal), the
+    // data then having to be moved into
+    // memory allocated by this buffer's
+    // allocator
+
+    static constexpr bool                                       isMoveAssignmentNoexcept = std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value ||
+                                                                                           std::allocator_traits<allocator_type>::is_always_equal::value;
+
+
+
 public: // Constructors and destructors
 
 
@@ -79,9 +138,19 @@ public: // Constructors and destructors
 
 
 
-    // Copy constructor
+    // Copy constructor (the copy holds
+    // its own copy of the data the source
+    // owns, in the same kind of memory)
+
+    blBuffer_0(const blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>& buffer0);
+
 
-    blBuffer_0(const blBuffer_0<blDataType,blMaxNumOfDimensions>& buffer0) = default;
+
+    // Move constructor (steals the
+    // source's data, leaving the
+    // source an empty buffer)
+
+    blBuffer_0(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept;
 
 
 
@@ -95,9 +164,19 @@ public: // Overloaded operators
 
 
 
-    // Assignment operator
+    // Assignment operator (same
+    // as the copy constructor)
+
+    blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>&                operator=(const blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>& buffer0);
 
-    blBuffer_0<blDataType,blMaxNumOfDimensions>&                operator=(const blBuffer_0<blDataType,blMaxNumOfDimensions>& buffer0) = default;
+
+
+    // Move assignment operator (it
+    // can only throw when the data's
+    // allocator can't be moved along
+    // with the data, see above)
+
+    blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>&                operator=(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept(isMoveAssignmentNoexcept);
 
 
 
@@ -118,6 +197,47 @@ public: // Public functions
 
 
 
+    // Function used to know whether the
+    // buffer's data is mirrored, that is
+    // whether data()[i + size()] is the
+    // same data point as data()[i]
+
+    bool                                                        isMirrored()const;
+
+
+
+    // Function used to get the size of the
+    // pages backing the buffer's data, which
+    // is zero when the buffer wraps data it
+    // knows nothing about
+
+    const std::size_t&                                          sizeOfPages()const;
+
+
+
+protected: // Protected functions
+
+
+
+    // Functions used to get the data the
+    // buffer owns (wherever it's held) and
+    // the size of the pages backing it
+
+    blDataType*                                                 ownedData();
+    const blDataType*                                           ownedData()const;
+    std::size_t                                                 sizeOfPagesOfOwnedData()const;
+
+
+
+    // Function used by the copy operations
+    // to copy the data the source holds in
+    // mirrored or mapped memory into memory
+    // of the same kind (or into the data
+    // vector if that memory can't be had)
+
+    void                                                        copyOwnedDataFrom(const blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>& buffer0);
+
+
 
 protected: // Protected variables
 
@@ -126,9 +246,35 @@ protected: // Protected variables
     // The main dynamic array
     // holding the buffer data
     // if the buffer owns the
-    // data
+    // data (its allocator is the
+    // user's, adapted to leave trivial
+    // data types uninitialized)
+
+    std::vector<blDataType,blDefaultInitAllocator<blDataType,allocator_type> > m_data;
+
+
+
+    // The mirrored memory holding the
+    // buffer data when the buffer owns
+    // its data and it's mirrored, and
+    // whether the data the buffer points
+    // to is mirrored (owned or not)
+
+    blMirroredMemory                                            m_mirroredData;
+
+    bool                                                        m_isMirrored;
 
-    std::vector<blDataType>                                     m_data;
+
+
+    // The memory holding the buffer data
+    // when the buffer owns its data and
+    // it asked for huge pages, and the size
+    // of the pages backing the data the
+    // buffer points to
+
+    blMappedMemory                                              m_mappedData;
+
+    std::size_t                                                 m_sizeOfPages;
 
 
 
@@ -145,10 +291,62 @@ protected: // Protected variables
 // Default constructor
 //-------------------------------------------------------------------
 template<typename blDataType,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::blBuffer_0()
+{
+    m_isMirrored = false;
+    m_sizeOfPages = 0;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_0<blDataType,blMaxNumOfDimensions>::blBuffer_0()
+inline blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::blBuffer_0(const blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>& buffer0) : m_data(buffer0.m_data)
+{
+    m_isMirrored = buffer0.m_isMirrored;
+    m_sizeOfPages = buffer0.m_sizeOfPages;
+    m_properties = buffer0.m_properties;
+
+    copyOwnedDataFrom(buffer0);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Move constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::blBuffer_0(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept
+                                                                            : m_data(std::move(buffer0.m_data)),
+                                                                              m_mirroredData(std::move(buffer0.m_mirroredData)),
+                                                                              m_isMirrored(buffer0.m_isMirrored),
+                                                                              m_mappedData(std::move(buffer0.m_mappedData)),
+                                                                              m_sizeOfPages(buffer0.m_sizeOfPages),
+                                                                              m_properties(buffer0.m_properties)
 {
+    // Move constructing the data vector
+    // always steals its data (whatever
+    // the allocator), so the data keeps
+    // its address, and all that's left
+    // is to leave the source empty
+
+    buffer0.m_data.clear();
+    buffer0.m_isMirrored = false;
+    buffer0.m_sizeOfPages = 0;
+    buffer0.m_properties = blDimensionalProperties<blMaxNumOfDimensions>();
 }
 //-------------------------------------------------------------------
 
@@ -158,22 +356,109 @@ inline blBuffer_0<blDataType,blMaxNumOfDimensions>::blBuffer_0()
 // Destructor
 //-------------------------------------------------------------------
 template<typename blDataType,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_0<blDataType,blMaxNumOfDimensions>::~blBuffer_0()
+inline blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::~blBuffer_0()
 {
 }
 //-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>& blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::operator=(const blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>& buffer0)
+{
+    if(this == &buffer0)
+        return (*this);
+
+
+
+    // We drop whichever memory held
+    // our data before copying the
+    // source's data
+
+    m_mirroredData.release();
+    m_mappedData.release();
+
+    m_data = buffer0.m_data;
+
+    m_isMirrored = buffer0.m_isMirrored;
+    m_sizeOfPages = buffer0.m_sizeOfPages;
+    m_properties = buffer0.m_properties;
+
+    copyOwnedDataFrom(buffer0);
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Move assignment operator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>& blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::operator=(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept(isMoveAssignmentNoexcept)
+{
+    if(this == &buffer0)
+        return (*this);
+
+
+
+    // We steal whichever memory holds
+    // the source's data (no data point
+    // is copied, the data keeps its address,
+    // unless the data vector's allocator
+    // stays with this buffer and isn't equal
+    // to the source's, in which case the data
+    // points are moved into memory allocated
+    // by this buffer's allocator)
+
+    m_data = std::move(buffer0.m_data);
+    m_mirroredData = std::move(buffer0.m_mirroredData);
+    m_mappedData = std::move(buffer0.m_mappedData);
+
+    m_isMirrored = buffer0.m_isMirrored;
+    m_sizeOfPages = buffer0.m_sizeOfPages;
+    m_properties = buffer0.m_properties;
+
+
+
+    // Then we leave the
+    // source empty
+
+    buffer0.m_data.clear();
+    buffer0.m_mirroredData = blMirroredMemory();
+    buffer0.m_mappedData = blMappedMemory();
+
+    buffer0.m_isMirrored = false;
+    buffer0.m_sizeOfPages = 0;
+    buffer0.m_properties = blDimensionalProperties<blMaxNumOfDimensions>();
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Function used to get the buffer's properties
 //-------------------------------------------------------------------
 template<typename blDataType,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline const blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_0<blDataType,blMaxNumOfDimensions>::properties()const
+inline const blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::properties()const
 {
     return m_properties;
 }
@@ -187,9 +472,10 @@ inline const blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_0<blDataTyp
 // get the buffer's properties
 //-------------------------------------------------------------------
 template<typename blDataType,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions>::size()const
+inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::size()const
 {
     return m_properties.size();
 }
@@ -197,9 +483,10 @@ inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions>::size()con
 
 
 template<typename blDataType,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions>::length()const
+inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::length()const
 {
     return m_properties.size();
 }
@@ -213,9 +500,10 @@ inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions>::length()c
 // having to first get the buffer's properties
 //-------------------------------------------------------------------
 template<typename blDataType,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions>::size(const std::size_t&  dimension)const
+inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::size(const std::size_t&  dimension)const
 {
     return m_properties.size(dimension);
 }
@@ -223,9 +511,10 @@ inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions>::size(cons
 
 
 template<typename blDataType,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions>::length(const std::size_t&  dimension)const
+inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::length(const std::size_t&  dimension)const
 {
     return m_properties.size(dimension);
 }
@@ -233,6 +522,136 @@ inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions>::length(co
 
 
 
+//-------------------------------------------------------------------
+// Function used to know whether the data is mirrored
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline bool blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMirrored()const
+{
+    return m_isMirrored;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to get the size of the pages backing the data
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const std::size_t& blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::sizeOfPages()const
+{
+    return m_sizeOfPages;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get the data owned by the buffer
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blDataType* blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::ownedData()
+{
+    if(m_mirroredData.isAllocated())
+        return static_cast<blDataType*>(m_mirroredData.data());
+
+    if(m_mappedData.isAllocated())
+        return static_cast<blDataType*>(m_mappedData.data());
+
+    return (m_data.empty() ? nullptr : m_data.data());
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const blDataType* blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::ownedData()const
+{
+    return const_cast<blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>*>(this)->ownedData();
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::sizeOfPagesOfOwnedData()const
+{
+    if(m_mirroredData.isAllocated())
+        return m_mirroredData.sizeOfPages();
+
+    if(m_mappedData.isAllocated())
+        return m_mappedData.sizeOfPages();
+
+    return (m_data.empty() ? std::size_t(0) : blMappedMemory::pageSize());
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used by the copy operations to copy
+// the data held in mirrored or mapped memory
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::copyOwnedDataFrom(const blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>& buffer0)
+{
+    // Data held in the data vector
+    // was already copied along with
+    // the vector itself
+
+    const blDataType* sourceData = buffer0.ownedData();
+
+    if(buffer0.m_mirroredData.isAllocated())
+    {
+        if(m_mirroredData.allocate(buffer0.m_mirroredData.size(),buffer0.m_mirroredData.pageType()))
+        {
+            std::uninitialized_copy_n(sourceData,size(),static_cast<blDataType*>(m_mirroredData.data()));
+            return;
+        }
+    }
+    else if(buffer0.m_mappedData.isAllocated())
+    {
+        if(m_mappedData.allocate(buffer0.m_mappedData.size(),buffer0.m_mappedData.pageType()))
+        {
+            std::uninitialized_copy_n(sourceData,size(),static_cast<blDataType*>(m_mappedData.data()));
+            return;
+        }
+    }
+    else
+        return;
+
+
+
+    // We couldn't get the same kind
+    // of memory, so the copy holds its
+    // data in the data vector (and it's
+    // no longer mirrored)
+
+    m_data.assign(sourceData,sourceData + size());
+
+    m_isMirrored = false;
+    m_sizeOfPages = sizeOfPagesOfOwnedData();
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // End of namespace
 }
@@ -73,9 +73,10 @@ namespace blBufferLIB
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-class blBuffer_1 : public blBuffer_0<blDataType,blMaxNumOfDimensions>
+class blBuffer_1 : public blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>
 {
 public: // Public type aliases
 
@@ -101,9 +102,20 @@ public: // Constructors and destructors
 
 
 
-    // Copy constructor
+    // Copy constructor (the copy's
+    // iterators point to its own copy
+    // of the data, or to the same
+    // external data the source wraps)
 
-    blBuffer_1(const blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>& buffer1) = default;
+    blBuffer_1(const blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer1);
+
+
+
+    // Move constructor (steals the
+    // source's data and re-seats the
+    // iterators onto it)
+
+    blBuffer_1(blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&& buffer1) noexcept;
 
 
 
@@ -117,9 +129,16 @@ public: // Overloaded operators
 
 
 
-    // Assignment operator
+    // Assignment operator (same
+    // as the copy constructor)
+
+    blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&      operator=(const blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer1);
+
+
 
-    blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>&      operator=(const blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>& buffer1) = default;
+    // Move assignment operator
+
+    blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&      operator=(blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&& buffer1) noexcept(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMoveAssignmentNoexcept);
 
 
 
@@ -258,6 +277,19 @@ protected: // Protected functions
 
 
 
+    // Functions used by the copy and move
+    // operations to point the data pointers
+    // like the source's and to take over
+    // the source's data pointers
+
+    void                                                        copyDataPointersFrom(const blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer1,
+                                                                                     const bool& didSourceOwnData);
+
+    void                                                        takeDataPointersFrom(blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer1,
+                                                                                     const bool& didSourceOwnData);
+
+
+
 private: // Private variables
 
 
@@ -294,9 +326,10 @@ private: // Private variables
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::blBuffer_1() : blBuffer_0<blDataType,blMaxNumOfDimensions>()
+inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_1() : blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>()
 {
     // Default all data iterators
     // to null pointers
@@ -312,32 +345,177 @@ inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::blBuffer_1() : blB
 
 
 
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_1(const blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer1) : blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>(buffer1)
+{
+    copyDataPointersFrom(buffer1,buffer1.doesBufferOwnData());
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Move constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_1(blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&& buffer1) noexcept : blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>(std::move(buffer1))
+{
+    // Moving the data vector keeps
+    // the data's address, so the source
+    // owned its data if its iterators
+    // point to the data we now own
+
+    takeDataPointersFrom(buffer1,buffer1.m_begin == this->ownedData());
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Destructor
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::~blBuffer_1()
+inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::~blBuffer_1()
 {
 }
 //-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator=(const blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer1)
+{
+    if(this == &buffer1)
+        return (*this);
+
+    blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::operator=(buffer1);
+
+    copyDataPointersFrom(buffer1,buffer1.doesBufferOwnData());
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Move assignment operator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator=(blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&& buffer1) noexcept(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMoveAssignmentNoexcept)
+{
+    if(this == &buffer1)
+        return (*this);
+
+    bool didSourceOwnData = buffer1.doesBufferOwnData();
+
+    blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::operator=(std::move(buffer1));
+
+    takeDataPointersFrom(buffer1,didSourceOwnData);
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used by the copy and move operations
+// to point this buffer's iterators to the data
+// copied or stolen from the source buffer (or to
+// the external data the source was wrapping),
+// the move operations also leave the source empty
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::copyDataPointersFrom(const blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer1,
+                                                                                                    const bool& didSourceOwnData)
+{
+    // If the source owned its data, we
+    // point to the data we now own (a data
+    // vector with a different allocator
+    // might have had to move its data points
+    // elsewhere), otherwise the source was
+    // wrapping external data and we wrap it too
+
+    if(didSourceOwnData)
+        resetDataPointers();
+    else
+    {
+        m_begin = buffer1.m_begin;
+        m_end = buffer1.m_end;
+        m_rbegin = buffer1.m_rbegin;
+        m_rend = buffer1.m_rend;
+
+        m_sizeOfSingleDataPoint = buffer1.m_sizeOfSingleDataPoint;
+    }
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::takeDataPointersFrom(blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer1,
+                                                                                                    const bool& didSourceOwnData)
+{
+    copyDataPointersFrom(buffer1,didSourceOwnData);
+
+
+
+    // The source buffer
+    // is now empty
+
+    buffer1.resetDataPointers();
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // wrap functions -- used to wrap data from an external source
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType,
          typename...blIntegerType>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType& firstDataPoint,
-                                                                        const blIntegerType&... bufferLengths)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType& firstDataPoint,
+                                                                                    const blIntegerType&... bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths...);
     wrap(firstDataPoint);
@@ -347,12 +525,13 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType& firstDataPoint,
-                                                                        const std::initializer_list<std::size_t>& bufferLengths)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType& firstDataPoint,
+                                                                                    const std::initializer_list<std::size_t>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
     wrap(firstDataPoint);
@@ -362,12 +541,13 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType& firstDataPoint,
-                                                                        const std::vector<std::size_t>& bufferLengths)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType& firstDataPoint,
+                                                                                    const std::vector<std::size_t>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
     wrap(firstDataPoint);
@@ -377,13 +557,14 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType,
          std::size_t blNumberOfDimensions>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType& firstDataPoint,
-                                                                        const std::array<std::size_t,blNumberOfDimensions>& bufferLengths)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType& firstDataPoint,
+                                                                                    const std::array<std::size_t,blNumberOfDimensions>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
     wrap(firstDataPoint);
@@ -393,13 +574,14 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType,
          typename...blIntegerType>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType* dataPointer,
-                                                                        const blIntegerType&... bufferLengths)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType* dataPointer,
+                                                                                    const blIntegerType&... bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths...);
     wrap(dataPointer);
@@ -409,12 +591,13 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType* dataPointer,
-                                                                        const std::initializer_list<std::size_t>& bufferLengths)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType* dataPointer,
+                                                                                    const std::initializer_list<std::size_t>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
     wrap(dataPointer);
@@ -424,12 +607,13 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType* dataPointer,
-                                                                        const std::vector<std::size_t>& bufferLengths)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType* dataPointer,
+                                                                                    const std::vector<std::size_t>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
     wrap(dataPointer);
@@ -439,13 +623,14 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType,
          std::size_t blNumberOfDimensions>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType* dataPointer,
-                                                                        const std::array<std::size_t,blNumberOfDimensions>& bufferLengths)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType* dataPointer,
+                                                                                    const std::array<std::size_t,blNumberOfDimensions>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
     wrap(dataPointer);
@@ -455,11 +640,12 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType& firstDataPoint)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType& firstDataPoint)
 {
     // We assume the data sizes and offsets
     // have already been properly set, so
@@ -474,11 +660,12 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blExistinDataType>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExistinDataType* dataPointer)
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::wrap(blExistinDataType* dataPointer)
 {
     // We assume the data sizes and offsets
     // have already been properly set, so
@@ -500,6 +687,16 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
     // type than "blDataType"
 
     m_sizeOfSingleDataPoint = sizeof(blExistinDataType);
+
+
+
+    // External data is not known to be
+    // mirrored nor its pages, buffers
+    // wrapping such data have to say
+    // so themselves
+
+    this->m_isMirrored = false;
+    this->m_sizeOfPages = 0;
 }
 //-------------------------------------------------------------------
 
@@ -513,17 +710,27 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::wrap(blExisti
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::resetDataPointers()
+inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::resetDataPointers()
 {
     // First we set the
     // data iterators and
-    // pointers
+    // pointers, the data
+    // being either in the
+    // mirrored memory, in
+    // the mapped memory or
+    // in the data vector
 
-    if(this->m_data.size() > 0)
+    this->m_isMirrored = this->m_mirroredData.isAllocated();
+    this->m_sizeOfPages = this->sizeOfPagesOfOwnedData();
+
+    blDataType* ownedData = this->ownedData();
+
+    if(ownedData != nullptr)
     {
-        m_begin = this->m_data.data();
+        m_begin = ownedData;
         m_end = m_begin + this->size();
 
         m_rbegin = reverse_iterator(m_begin + (this->size() - 1));
@@ -557,11 +764,16 @@ inline void blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::resetDataPoin
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline bool blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::doesBufferOwnData()const
+inline bool blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::doesBufferOwnData()const
 {
-    return ( m_begin == this->m_data.data() );
+    // Fancy data pointers (like offset
+    // pointers) only compare to non-const
+    // raw pointers
+
+    return ( m_begin == const_cast<blDataType*>(this->ownedData()) );
 }
 //-------------------------------------------------------------------
 
@@ -573,9 +785,10 @@ inline bool blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::doesBufferOwn
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::data()
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::data()
 {
     return m_begin;
 }
@@ -584,9 +797,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::iterator
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::data()const
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::const_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::data()const
 {
     return m_begin;
 }
@@ -601,9 +815,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_ite
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline unsigned char* blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::dataBytes()
+inline unsigned char* blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::dataBytes()
 {
     return reinterpret_cast<unsigned char*>(&(*m_begin));
 }
@@ -612,9 +827,10 @@ inline unsigned char* blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::dat
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline const unsigned char* blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::dataBytes()const
+inline const unsigned char* blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::dataBytes()const
 {
     return reinterpret_cast<const unsigned char*>(&(*m_begin));
 }
@@ -627,9 +843,10 @@ inline const unsigned char* blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::begin()
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::begin()
 {
     return m_begin;
 }
@@ -638,9 +855,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::iterator
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::end()
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::end()
 {
     return m_end;
 }
@@ -649,9 +867,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::iterator
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::cbegin()const
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::const_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::cbegin()const
 {
     return m_begin;
 }
@@ -660,9 +879,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_ite
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::cend()const
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::const_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::cend()const
 {
     return m_end;
 }
@@ -671,9 +891,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_ite
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::reverse_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::rbegin()
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::reverse_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::rbegin()
 {
     return m_rbegin;
 }
@@ -682,9 +903,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::reverse_i
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::reverse_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::rend()
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::reverse_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::rend()
 {
     return m_rend;
 }
@@ -693,9 +915,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::reverse_i
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_reverse_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::crbegin()const
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::const_reverse_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::crbegin()const
 {
     return m_rbegin;
 }
@@ -704,9 +927,10 @@ inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_rev
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::const_reverse_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>::crend()const
+inline typename blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::const_reverse_iterator blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::crend()const
 {
     return m_rend;
 }
@@ -56,9 +56,10 @@ namespace blBufferLIB
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-class blBuffer_2 : public blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>
+class blBuffer_2 : public blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>
 {
 public: // Constructors and destructors
 
@@ -72,7 +73,13 @@ public: // Constructors and destructors
 
     // Copy constructor
 
-    blBuffer_2(const blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>& buffer2) = default;
+    blBuffer_2(const blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer2) = default;
+
+
+
+    // Move constructor
+
+    blBuffer_2(blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&& buffer2) noexcept = default;
 
 
 
@@ -88,7 +95,13 @@ public: // Overloaded operators
 
     // Assignment operator
 
-    blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>&               operator=(const blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>& buffer2) = default;
+    blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&               operator=(const blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>& buffer2) = default;
+
+
+
+    // Move assignment operator
+
+    blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&               operator=(blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>&& buffer2) = default;
 
 
 
@@ -211,6 +224,21 @@ public: // Public functions
 
     template<typename blIntegerType>
     const blDataType&                               at(const std::vector<blIntegerType>& dataIndexes)const;
+
+
+
+protected: // Protected functions
+
+
+
+    // Function used to turn n-dimensional
+    // indexes into a data index, the fold
+    // expression unrolls into a single dot
+    // product with the cached sizes of a
+    // single unit of each dimension
+
+    template<typename...blIntegerTypes>
+    std::size_t                                     linearIndex(const blIntegerTypes&...dataIndexes)const;
 };
 //-------------------------------------------------------------------
 
@@ -221,9 +249,10 @@ public: // Public functions
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::blBuffer_2() : blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions>()
+inline blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_2() : blBuffer_1<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>()
 {
 }
 //-------------------------------------------------------------------
@@ -235,9 +264,10 @@ inline blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::blBuffer_2() : blB
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::~blBuffer_2()
+inline blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::~blBuffer_2()
 {
 }
 //-------------------------------------------------------------------
@@ -249,11 +279,12 @@ inline blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::~blBuffer_2()
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator[](const blIntegerType& dataIndex)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator[](const blIntegerType& dataIndex)
 {
     return this->data()[static_cast<std::size_t>(dataIndex)];
 }
@@ -262,11 +293,12 @@ inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operat
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator[](const blIntegerType& dataIndex)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator[](const blIntegerType& dataIndex)const
 {
     return this->data()[static_cast<std::size_t>(dataIndex)];
 }
@@ -279,11 +311,12 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const blIntegerType& dataIndex)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const blIntegerType& dataIndex)
 {
     return this->data()[dataIndex];
 }
@@ -292,11 +325,12 @@ inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operat
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const blIntegerType& dataIndex)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const blIntegerType& dataIndex)const
 {
     return this->data()[dataIndex];
 }
@@ -305,58 +339,62 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const blIntegerType& rowIndex,
-                                                                                     const blIntegerType& colIndex)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const blIntegerType& rowIndex,
+                                                                                                 const blIntegerType& colIndex)
 {
-    return this->data()[colIndex * this->properties().rows() + rowIndex];
+    return this->data()[colIndex * this->properties().pitch(0) + rowIndex];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const blIntegerType& rowIndex,
-                                                                                           const blIntegerType& colIndex)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const blIntegerType& rowIndex,
+                                                                                                       const blIntegerType& colIndex)const
 {
-    return this->data()[colIndex * this->properties().rows() + rowIndex];
+    return this->data()[colIndex * this->properties().pitch(0) + rowIndex];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const blIntegerType& rowIndex,
-                                                                                     const blIntegerType& colIndex,
-                                                                                     const blIntegerType& pageIndex)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const blIntegerType& rowIndex,
+                                                                                                 const blIntegerType& colIndex,
+                                                                                                 const blIntegerType& pageIndex)
 {
-    return this->data()[pageIndex * this->properties().cols() * this->properties().rows() + colIndex * this->properties().rows() + rowIndex];
+    return this->data()[pageIndex * this->properties().sizeOfSingleUnitInSpecificDimension(2) + colIndex * this->properties().pitch(0) + rowIndex];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const blIntegerType& rowIndex,
-                                                                                           const blIntegerType& colIndex,
-                                                                                           const blIntegerType& pageIndex)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const blIntegerType& rowIndex,
+                                                                                                       const blIntegerType& colIndex,
+                                                                                                       const blIntegerType& pageIndex)const
 {
-    return this->data()[pageIndex * this->properties().cols() * this->properties().rows() + colIndex * this->properties().rows() + rowIndex];
+    return this->data()[pageIndex * this->properties().sizeOfSingleUnitInSpecificDimension(2) + colIndex * this->properties().pitch(0) + rowIndex];
 }
 //-------------------------------------------------------------------
 
@@ -367,57 +405,56 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...blIntegerTypes>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const blIntegerTypes&...dataIndexes)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const blIntegerTypes&...dataIndexes)
 {
-    return this->at({dataIndexes...});
+    return this->data()[this->linearIndex(dataIndexes...)];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...blIntegerTypes>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const blIntegerTypes&...dataIndexes)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const blIntegerTypes&...dataIndexes)const
 {
-    return this->at({dataIndexes...});
+    return this->data()[this->linearIndex(dataIndexes...)];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const std::initializer_list<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const std::initializer_list<blIntegerType>& dataIndexes)
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = currentDataIndex;
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += static_cast<std::size_t>(partialIndex);
+        dataIndex += static_cast<std::size_t>(currentDataIndex) * unitSizes[i];
 
         ++i;
     }
@@ -435,31 +472,28 @@ inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operat
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const std::initializer_list<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const std::initializer_list<blIntegerType>& dataIndexes)const
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = currentDataIndex;
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += static_cast<std::size_t>(partialIndex);
+        dataIndex += static_cast<std::size_t>(currentDataIndex) * unitSizes[i];
 
         ++i;
     }
@@ -477,31 +511,28 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const std::vector<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const std::vector<blIntegerType>& dataIndexes)
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = currentDataIndex;
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += static_cast<std::size_t>(partialIndex);
+        dataIndex += static_cast<std::size_t>(currentDataIndex) * unitSizes[i];
 
         ++i;
     }
@@ -519,31 +550,28 @@ inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operat
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::operator()(const std::vector<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::operator()(const std::vector<blIntegerType>& dataIndexes)const
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = currentDataIndex;
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += static_cast<std::size_t>(partialIndex);
+        dataIndex += static_cast<std::size_t>(currentDataIndex) * unitSizes[i];
 
         ++i;
     }
@@ -566,11 +594,12 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const blIntegerType& dataIndex)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const blIntegerType& dataIndex)
 {
     return this->data()[dataIndex];
 }
@@ -579,11 +608,12 @@ inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(con
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const blIntegerType& dataIndex)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const blIntegerType& dataIndex)const
 {
     return this->data()[dataIndex];
 }
@@ -592,58 +622,62 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const blIntegerType& rowIndex,
-                                                                             const blIntegerType& colIndex)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const blIntegerType& rowIndex,
+                                                                                         const blIntegerType& colIndex)
 {
-    return this->data()[colIndex * this->properties().rows() + rowIndex];
+    return this->data()[colIndex * this->properties().pitch(0) + rowIndex];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const blIntegerType& rowIndex,
-                                                                                   const blIntegerType& colIndex)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const blIntegerType& rowIndex,
+                                                                                               const blIntegerType& colIndex)const
 {
-    return this->data()[colIndex * this->properties().rows() + rowIndex];
+    return this->data()[colIndex * this->properties().pitch(0) + rowIndex];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const blIntegerType& rowIndex,
-                                                                             const blIntegerType& colIndex,
-                                                                             const blIntegerType& pageIndex)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const blIntegerType& rowIndex,
+                                                                                         const blIntegerType& colIndex,
+                                                                                         const blIntegerType& pageIndex)
 {
-    return this->data()[pageIndex * this->properties().cols() * this->properties().rows() + colIndex * this->properties().rows() + rowIndex];
+    return this->data()[pageIndex * this->properties().sizeOfSingleUnitInSpecificDimension(2) + colIndex * this->properties().pitch(0) + rowIndex];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const blIntegerType& rowIndex,
-                                                                                   const blIntegerType& colIndex,
-                                                                                   const blIntegerType& pageIndex)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const blIntegerType& rowIndex,
+                                                                                               const blIntegerType& colIndex,
+                                                                                               const blIntegerType& pageIndex)const
 {
-    return this->data()[pageIndex * this->properties().cols() * this->properties().rows() + colIndex * this->properties().rows() + rowIndex];
+    return this->data()[pageIndex * this->properties().sizeOfSingleUnitInSpecificDimension(2) + colIndex * this->properties().pitch(0) + rowIndex];
 }
 //-------------------------------------------------------------------
 
@@ -654,57 +688,56 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...blIntegerTypes>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const blIntegerTypes&...dataIndexes)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const blIntegerTypes&...dataIndexes)
 {
-    return this->at({dataIndexes...});
+    return this->data()[this->linearIndex(dataIndexes...)];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...blIntegerTypes>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const blIntegerTypes&...dataIndexes)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const blIntegerTypes&...dataIndexes)const
 {
-    return this->at({dataIndexes...});
+    return this->data()[this->linearIndex(dataIndexes...)];
 }
 
 
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const std::initializer_list<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const std::initializer_list<blIntegerType>& dataIndexes)
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = static_cast<std::size_t>(currentDataIndex);
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += partialIndex;
+        dataIndex += static_cast<std::size_t>(currentDataIndex) * unitSizes[i];
 
         ++i;
     }
@@ -722,31 +755,28 @@ inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(con
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const std::initializer_list<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const std::initializer_list<blIntegerType>& dataIndexes)const
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = static_cast<std::size_t>(currentDataIndex);
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += partialIndex;
+        dataIndex += static_cast<std::size_t>(currentDataIndex) * unitSizes[i];
 
         ++i;
     }
@@ -764,31 +794,28 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const std::vector<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const std::vector<blIntegerType>& dataIndexes)
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = static_cast<std::size_t>(currentDataIndex);
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += partialIndex;
+        dataIndex += static_cast<std::size_t>(currentDataIndex) * unitSizes[i];
 
         ++i;
     }
@@ -806,31 +833,28 @@ inline blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(con
 
 template<typename blDataType,
          typename blDataPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::at(const std::vector<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::at(const std::vector<blIntegerType>& dataIndexes)const
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = static_cast<std::size_t>(currentDataIndex);
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += partialIndex;
+        dataIndex += static_cast<std::size_t>(currentDataIndex) * unitSizes[i];
 
         ++i;
     }
@@ -847,6 +871,36 @@ inline const blDataType& blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>::
 
 
 
+//-------------------------------------------------------------------
+// Function used to turn n-dimensional
+// indexes into a data index
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename...blIntegerTypes>
+
+inline std::size_t blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>::linearIndex(const blIntegerTypes&...dataIndexes)const
+{
+    static_assert(sizeof...(blIntegerTypes) <= blMaxNumOfDimensions,
+                  "blBuffer_2::linearIndex -- more indexes than the buffer has dimensions");
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
+    std::size_t dataIndex = 0;
+
+    std::size_t i = 0;
+
+    ((dataIndex += static_cast<std::size_t>(dataIndexes) * unitSizes[i++]), ...);
+
+    return dataIndex;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // End of namespace
 }
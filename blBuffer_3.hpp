@@ -72,9 +72,10 @@ namespace blBufferLIB
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-class blBuffer_3 : public blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>
+class blBuffer_3 : public blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>
 {
 public: // Public type aliases
 
@@ -82,11 +83,11 @@ public: // Public type aliases
 
     // Buffer circular iterators
 
-    using circular_iterator = blCircularIterator< blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>,blBufferPtr >;
-    using circular_const_iterator = blCircularIterator< blBuffer_2<blDataType,const blDataPtr,blMaxNumOfDimensions>,const blBufferPtr >;
+    using circular_iterator = blCircularIterator< blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>,blBufferPtr >;
+    using circular_const_iterator = blCircularIterator< blBuffer_2<blDataType,const blDataPtr,blMaxNumOfDimensions,blAllocator>,const blBufferPtr >;
 
-    using circular_reverse_iterator = blCircularReverseIterator< blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>,blBufferPtr >;
-    using circular_const_reverse_iterator = blCircularReverseIterator< blBuffer_2<blDataType,const blDataPtr,blMaxNumOfDimensions>,const blBufferPtr >;
+    using circular_reverse_iterator = blCircularReverseIterator< blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>,blBufferPtr >;
+    using circular_const_reverse_iterator = blCircularReverseIterator< blBuffer_2<blDataType,const blDataPtr,blMaxNumOfDimensions,blAllocator>,const blBufferPtr >;
 
 
 
@@ -102,7 +103,13 @@ public: // Constructors and destructors
 
     // Copy constructor
 
-    blBuffer_3(const blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>& buffer3) = default;
+    blBuffer_3(const blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>& buffer3) = default;
+
+
+
+    // Move constructor
+
+    blBuffer_3(blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&& buffer3) noexcept = default;
 
 
 
@@ -118,7 +125,13 @@ public: // Overloaded operators
 
     // Assignment operator
 
-    blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>&      operator=(const blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>& buffer3) = default;
+    blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&      operator=(const blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>& buffer3) = default;
+
+
+
+    // Move assignment operator
+
+    blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&      operator=(blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&& buffer3) = default;
 
 
 
@@ -246,9 +259,10 @@ public: // Public functions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::blBuffer_3() : blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions>()
+inline blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_3() : blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAllocator>()
 {
 }
 //-------------------------------------------------------------------
@@ -261,9 +275,10 @@ inline blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::blBuff
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::~blBuffer_3()
+inline blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::~blBuffer_3()
 {
 }
 //-------------------------------------------------------------------
@@ -276,9 +291,10 @@ inline blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::~blBuf
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_begin(const std::ptrdiff_t& maxNumberOfCirculations)
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_begin(const std::ptrdiff_t& maxNumberOfCirculations)
 {
     return circular_iterator(this,0,maxNumberOfCirculations);
 }
@@ -288,9 +304,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_end()
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_end()
 {
     return circular_iterator(this,0,0);
 }
@@ -300,9 +317,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_const_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_cbegin(const std::ptrdiff_t& maxNumberOfCirculations)const
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_const_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_cbegin(const std::ptrdiff_t& maxNumberOfCirculations)const
 {
     return circular_const_iterator(this,0,maxNumberOfCirculations);
 }
@@ -312,9 +330,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_const_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_cend()const
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_const_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_cend()const
 {
     return circular_const_iterator(this,0,0);
 }
@@ -329,9 +348,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_rbegin(const std::ptrdiff_t& maxNumberOfCirculations)
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_rbegin(const std::ptrdiff_t& maxNumberOfCirculations)
 {
     return circular_reverse_iterator(this,0,maxNumberOfCirculations);
 }
@@ -341,9 +361,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_rend()
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_rend()
 {
     return circular_reverse_iterator(this,0,0);
 }
@@ -353,9 +374,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_const_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_crbegin(const std::ptrdiff_t& maxNumberOfCirculations)const
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_const_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_crbegin(const std::ptrdiff_t& maxNumberOfCirculations)const
 {
     return circular_const_reverse_iterator(this,0,maxNumberOfCirculations);
 }
@@ -365,9 +387,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_const_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_crend()const
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_const_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_crend()const
 {
     return circular_const_reverse_iterator(this,0,0);
 }
@@ -384,9 +407,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_iter(const std::ptrdiff_t& startingPositionIndex,
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_iter(const std::ptrdiff_t& startingPositionIndex,
                                                                                                                                                                                               const std::ptrdiff_t& maxNumberOfCirculations)
 {
     return circular_iterator(this,startingPositionIndex,maxNumberOfCirculations);
@@ -397,9 +421,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_const_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_citer(const std::ptrdiff_t& startingPositionIndex,
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_const_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_citer(const std::ptrdiff_t& startingPositionIndex,
                                                                                                                                                                                                      const std::ptrdiff_t& maxNumberOfCirculations)const
 {
     return circular_const_iterator(this,startingPositionIndex,maxNumberOfCirculations);
@@ -410,9 +435,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_riter(const std::ptrdiff_t& startingPositionIndex,
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_riter(const std::ptrdiff_t& startingPositionIndex,
                                                                                                                                                                                                        const std::ptrdiff_t& maxNumberOfCirculations)
 {
     return circular_reverse_iterator(this,startingPositionIndex,maxNumberOfCirculations);
@@ -423,9 +449,10 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circular_const_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_criter(const std::ptrdiff_t& startingPositionIndex,
+inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circular_const_reverse_iterator blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_criter(const std::ptrdiff_t& startingPositionIndex,
                                                                                                                                                                                                               const std::ptrdiff_t& maxNumberOfCirculations)const
 {
     return circular_const_reverse_iterator(this,startingPositionIndex,maxNumberOfCirculations);
@@ -440,11 +467,12 @@ inline typename blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const blIntegerType& dataIndex)
+inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const blIntegerType& dataIndex)
 {
     return this->at( this->circ_index(dataIndex,this->size()) );
 }
@@ -454,11 +482,12 @@ inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const blIntegerType& dataIndex)const
+inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const blIntegerType& dataIndex)const
 {
     return this->at( this->circ_index(dataIndex,this->size()) );
 }
@@ -468,15 +497,16 @@ inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const blIntegerType &rowIndex,
+inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const blIntegerType &rowIndex,
                                                                          const blIntegerType &colIndex)
 {
-    return this->at( this->circ_index(rowIndex,this->rows()),
-                     this->circ_index(colIndex,this->cols()) );
+    return this->at( this->circ_index(rowIndex,this->size(0)),
+                     this->circ_index(colIndex,this->size(1)) );
 }
 
 
@@ -484,15 +514,16 @@ inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const blIntegerType& rowIndex,
+inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const blIntegerType& rowIndex,
                                                                                const blIntegerType& colIndex)const
 {
-    return this->at( this->circ_index(rowIndex,this->rows()),
-                     this->circ_index(colIndex,this->cols()) );
+    return this->at( this->circ_index(rowIndex,this->size(0)),
+                     this->circ_index(colIndex,this->size(1)) );
 }
 
 
@@ -500,17 +531,18 @@ inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const blIntegerType& rowIndex,
+inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const blIntegerType& rowIndex,
                                                                          const blIntegerType& colIndex,
                                                                          const blIntegerType& pageIndex)
 {
-    return this->at( this->circ_index(rowIndex,this->rows()),
-                     this->circ_index(colIndex,this->cols()),
-                     this->circ_index(pageIndex,this->pages()) );
+    return this->at( this->circ_index(rowIndex,this->size(0)),
+                     this->circ_index(colIndex,this->size(1)),
+                     this->circ_index(pageIndex,this->size(2)) );
 }
 
 
@@ -518,17 +550,18 @@ inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const blIntegerType& rowIndex,
+inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const blIntegerType& rowIndex,
                                                                                const blIntegerType& colIndex,
                                                                                const blIntegerType& pageIndex)const
 {
-    return this->at( this->circ_index(rowIndex,this->rows()),
-                     this->circ_index(colIndex,this->cols()),
-                     this->circ_index(pageIndex,this->pages()) );
+    return this->at( this->circ_index(rowIndex,this->size(0)),
+                     this->circ_index(colIndex,this->size(1)),
+                     this->circ_index(pageIndex,this->size(2)) );
 }
 //-------------------------------------------------------------------
 
@@ -540,13 +573,31 @@ inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...Indexes>
 
-inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const Indexes&...dataIndexes)
+inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const Indexes&...dataIndexes)
 {
-    return this->circ_at({dataIndexes...});
+    static_assert(sizeof...(Indexes) <= blMaxNumOfDimensions,
+                  "blBuffer_3::circ_at -- more indexes than the buffer has dimensions");
+
+
+
+    // Same dot product as blBuffer_2's
+    // linearIndex, each index wrapped
+    // around its own dimension first
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
+    std::size_t dataIndex = 0;
+
+    std::size_t i = 0;
+
+    ((dataIndex += circ_index(dataIndexes,this->size(i)) * unitSizes[i], ++i), ...);
+
+    return this->data()[dataIndex];
 }
 
 
@@ -554,13 +605,31 @@ inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...Indexes>
 
-inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const Indexes&...dataIndexes)const
+inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const Indexes&...dataIndexes)const
 {
-    return this->circ_at({dataIndexes...});
+    static_assert(sizeof...(Indexes) <= blMaxNumOfDimensions,
+                  "blBuffer_3::circ_at -- more indexes than the buffer has dimensions");
+
+
+
+    // Same dot product as blBuffer_2's
+    // linearIndex, each index wrapped
+    // around its own dimension first
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
+    std::size_t dataIndex = 0;
+
+    std::size_t i = 0;
+
+    ((dataIndex += circ_index(dataIndexes,this->size(i)) * unitSizes[i], ++i), ...);
+
+    return this->data()[dataIndex];
 }
 
 
@@ -568,31 +637,28 @@ inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const std::initializer_list<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const std::initializer_list<blIntegerType>& dataIndexes)
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = circ_index(currentDataIndex,this->size(i));
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += partialIndex;
+        dataIndex += circ_index(currentDataIndex,this->size(i)) * unitSizes[i];
 
         ++i;
     }
@@ -611,31 +677,28 @@ inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const std::initializer_list<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const std::initializer_list<blIntegerType>& dataIndexes)const
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = circ_index(currentDataIndex,this->size(i));
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += partialIndex;
+        dataIndex += circ_index(currentDataIndex,this->size(i)) * unitSizes[i];
 
         ++i;
     }
@@ -654,31 +717,28 @@ inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const std::vector<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const std::vector<blIntegerType>& dataIndexes)
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = circ_index(currentDataIndex,this->size(i));
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += partialIndex;
+        dataIndex += circ_index(currentDataIndex,this->size(i)) * unitSizes[i];
 
         ++i;
     }
@@ -697,31 +757,28 @@ inline blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::circ_at(const std::vector<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::circ_at(const std::vector<blIntegerType>& dataIndexes)const
 {
+    // Each index is scaled by the
+    // (cached) size of a single unit
+    // of its dimension
+
+    const auto& unitSizes = this->properties().sizesOfSingleUnits();
+
     std::size_t dataIndex = 0;
 
     std::size_t i = 0;
-    std::size_t j = 0;
-
-    std::size_t partialIndex = 0;
 
 
 
     for(const blIntegerType& currentDataIndex : dataIndexes)
     {
-        partialIndex = circ_index(currentDataIndex,this->size(i));
-
-        for(j = 0; j < i; ++j)
-        {
-            partialIndex *= this->size(j);
-        }
-
-        dataIndex += partialIndex;
+        dataIndex += circ_index(currentDataIndex,this->size(i)) * unitSizes[i];
 
         ++i;
     }
@@ -48,6 +48,14 @@
 
 #include "blBuffer_3.hpp"
 
+
+
+// Used to check the number of
+// indexes passed in a container
+
+#include <cassert>
+#include <iterator>
+
 //-------------------------------------------------------------------
 
 
@@ -67,9 +75,10 @@ namespace blBufferLIB
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-class blBuffer_4 : public blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>
+class blBuffer_4 : public blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>
 {
 public: // Constructors and destructors
 
@@ -83,7 +92,14 @@ public: // Constructors and destructors
 
     // Copy constructor
 
-    blBuffer_4(const blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>& buffer0) = default;
+    blBuffer_4(const blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>& buffer0) = default;
+
+
+
+    // Move constructor (the source's
+    // ROI is reset to its now empty data)
+
+    blBuffer_4(blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept;
 
 
 
@@ -99,7 +115,13 @@ public: // Overloaded operators
 
     // Assignment operator
 
-    blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>&      operator=(const blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>& buffer0) = default;
+    blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&      operator=(const blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>& buffer0) = default;
+
+
+
+    // Move assignment operator
+
+    blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&      operator=(blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMoveAssignmentNoexcept);
 
 
 
@@ -122,6 +144,18 @@ public: // Public functions
 
 
 
+    // Function used to get the number of
+    // data points in each contiguous run of
+    // the ROI, a run spans the ROI along the
+    // first dimension and also along the
+    // following dimensions for as long as
+    // the ROI covers the buffer's whole
+    // (padded) extent of the previous ones
+
+    std::size_t                                                             roiRunLength()const;
+
+
+
     // "at" functions which do the same
     // thing as the operator(), they still
     // do not check for out of bound indexes
@@ -175,6 +209,36 @@ public: // Public functions
 
 
 
+protected: // Protected functions
+
+
+
+    // Functions used to get the data index
+    // (in the buffer) of the ROI's first data
+    // point and of a data point given its ROI
+    // coordinates, the dimensions that are
+    // not specified are taken to be zero
+    // within the ROI
+
+    std::size_t                                                             roiOriginDataIndex()const;
+
+    template<typename...Indexes>
+    std::size_t                                                             roiDataIndex(const Indexes&...dataIndexes)const;
+
+
+
+    // Function used to get the data index
+    // (in the buffer) of a data point given
+    // its ROI coordinates in a container (an
+    // initializer list or a vector), which
+    // can't hold more coordinates than the
+    // buffer has dimensions
+
+    template<typename blIndexIteratorType>
+    std::size_t                                                             roiDataIndexOf(blIndexIteratorType beginIndex,
+                                                                                           const blIndexIteratorType& endIndex)const;
+
+
 
 protected: // Protected variables
 
@@ -194,39 +258,87 @@ protected: // Protected variables
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::blBuffer_4() : blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>()
+inline blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_4() : blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>()
 {
 }
 //-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Move constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_4(blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept : blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>(std::move(buffer0))
+{
+    m_roi = buffer0.m_roi;
+
+    buffer0.resetROI();
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Destructor
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::~blBuffer_4()
+inline blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::~blBuffer_4()
 {
 }
 //-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Move assignment operator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::operator=(blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMoveAssignmentNoexcept)
+{
+    if(this == &buffer0)
+        return (*this);
+
+    blBuffer_3<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::operator=(std::move(buffer0));
+
+    m_roi = buffer0.m_roi;
+
+    buffer0.resetROI();
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Get/Set functions for the ROI
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi()
+inline blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi()
 {
     return m_roi;
 }
@@ -236,9 +348,10 @@ inline blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_4<blDataType,blDa
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline const blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi()const
+inline const blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi()const
 {
     return m_roi;
 }
@@ -254,11 +367,56 @@ inline const blDimensionalProperties<blMaxNumOfDimensions>& blBuffer_4<blDataTyp
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline void blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::resetROI()
+inline void blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::resetROI()
 {
+    // The ROI covers the buffer's data
+    // points, not the padding between
+    // them
+
     m_roi = this->m_properties;
+
+    m_roi.setPitchAlignments();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to get the number of data
+// points in each contiguous run of the ROI
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roiRunLength()const
+{
+    // Consecutive runs along the first
+    // dimension merge into one when the
+    // ROI's and the buffer's sizes of a
+    // single unit of the next dimension
+    // agree, that is when the ROI covers
+    // full rows and there is no padding
+
+    const auto& roiUnitSizes = m_roi.sizesOfSingleUnits();
+    const auto& bufferUnitSizes = this->properties().sizesOfSingleUnits();
+
+    std::size_t runLength = m_roi.size(0);
+
+    for(std::size_t i = 1; i < blMaxNumOfDimensions; ++i)
+    {
+        if(roiUnitSizes[i] != bufferUnitSizes[i])
+            break;
+
+        runLength = roiUnitSizes[i] * m_roi.size(i);
+    }
+
+    return runLength;
 }
 //-------------------------------------------------------------------
 
@@ -271,50 +429,48 @@ inline void blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::r
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const blIntegerType& dataIndex)
+inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const blIntegerType& dataIndex)
 {
-    // Vector of indeces used to
-    // address the correct data
-    // point in the buffer
+    // We decompose the ROI data index
+    // into ROI coordinates, from the last
+    // dimension down, using the ROI's cached
+    // sizes of single units, and offset each
+    // coordinate into the buffer as we go,
+    // so no array of indexes is ever built
 
-    std::vector<std::size_t> indexes(m_roi.dimensions(),std::size_t(0));
+    const auto& roiUnitSizes = m_roi.sizesOfSingleUnits();
+    const auto& bufferUnitSizes = this->properties().sizesOfSingleUnits();
 
+    std::size_t remainingDataIndex = static_cast<std::size_t>(dataIndex);
 
+    std::size_t bufferDataIndex = 0;
 
-    // Here we calculate the coordinates
-    // of the data point in our nd-buffer
+    std::size_t coordinate = 0;
 
-    for(int i = static_cast<int>(indexes.size()) - 1; i >= 0 ; --i)
+
+
+    for(std::size_t i = blMaxNumOfDimensions - 1; i > 0; --i)
     {
-        if(i == static_cast<int>(indexes.size()) - 1)
-        {
-            indexes[i] = dataIndex / m_roi.sizeOfSingleUnitInSpecificDimension(i);
-        }
-        else if(i > 0)
-        {
-            indexes[i] = (dataIndex - indexes[i + 1] * m_roi.sizeOfSingleUnitInSpecificDimension(i + 1)) / m_roi.sizeOfSingleUnitInSpecificDimension(i);
-        }
-        else
-        {
-            indexes[i] = dataIndex % m_roi.size(0);
-            indexes[i] += m_roi.offset(0);
+        coordinate = remainingDataIndex / roiUnitSizes[i];
 
-            break;
-        }
+        remainingDataIndex -= coordinate * roiUnitSizes[i];
 
-        indexes[i] += m_roi.offset(i);
+        bufferDataIndex += (coordinate + m_roi.offset(i)) * bufferUnitSizes[i];
     }
 
 
 
-    // Then we access the data point in the
-    // buffer using the newly found ROI coordinates
+    // What's left is the coordinate
+    // along the first dimension
+
+    bufferDataIndex += remainingDataIndex + m_roi.offset(0);
 
-    return this->at(indexes);
+    return this->data()[bufferDataIndex];
 }
 
 
@@ -322,50 +478,48 @@ inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const blIntegerType& dataIndex)const
+inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const blIntegerType& dataIndex)const
 {
-    // Vector of indeces used to
-    // address the correct data
-    // point in the buffer
+    // We decompose the ROI data index
+    // into ROI coordinates, from the last
+    // dimension down, using the ROI's cached
+    // sizes of single units, and offset each
+    // coordinate into the buffer as we go,
+    // so no array of indexes is ever built
 
-    std::vector<std::size_t> indexes(m_roi.dimensions(),std::size_t(0));
+    const auto& roiUnitSizes = m_roi.sizesOfSingleUnits();
+    const auto& bufferUnitSizes = this->properties().sizesOfSingleUnits();
 
+    std::size_t remainingDataIndex = static_cast<std::size_t>(dataIndex);
 
+    std::size_t bufferDataIndex = 0;
 
-    // Here we calculate the coordinates
-    // of the data point in our nd-buffer
+    std::size_t coordinate = 0;
 
-    for(int i = static_cast<int>(indexes.size()) - 1; i >= 0 ; --i)
+
+
+    for(std::size_t i = blMaxNumOfDimensions - 1; i > 0; --i)
     {
-        if(i == static_cast<int>(indexes.size()) - 1)
-        {
-            indexes[i] = dataIndex / m_roi.sizeOfSingleUnitInSpecificDimension(i);
-        }
-        else if(i > 0)
-        {
-            indexes[i] = (dataIndex - indexes[i + 1] * m_roi.sizeOfSingleUnitInSpecificDimension(i + 1)) / m_roi.sizeOfSingleUnitInSpecificDimension(i);
-        }
-        else
-        {
-            indexes[i] = dataIndex % m_roi.size(0);
-            indexes[i] += m_roi.offset(0);
+        coordinate = remainingDataIndex / roiUnitSizes[i];
 
-            break;
-        }
+        remainingDataIndex -= coordinate * roiUnitSizes[i];
 
-        indexes[i] += m_roi.offset(i);
+        bufferDataIndex += (coordinate + m_roi.offset(i)) * bufferUnitSizes[i];
     }
 
 
 
-    // Then we access the data point in the
-    // buffer using the newly found ROI coordinates
+    // What's left is the coordinate
+    // along the first dimension
+
+    bufferDataIndex += remainingDataIndex + m_roi.offset(0);
 
-    return this->at(indexes);
+    return this->data()[bufferDataIndex];
 }
 
 
@@ -373,14 +527,15 @@ inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const blIntegerType& rowIndex,
-                                                                                             const blIntegerType& colIndex)
+inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const blIntegerType& rowIndex,
+                                                                                                         const blIntegerType& colIndex)
 {
-    return this->at(rowIndex + m_roi.rowOffset(),colIndex + m_roi.colOffset());
+    return this->data()[roiDataIndex(rowIndex,colIndex)];
 }
 
 
@@ -388,14 +543,15 @@ inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const blIntegerType& rowIndex,
-                                                                                                   const blIntegerType& colIndex)const
+inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const blIntegerType& rowIndex,
+                                                                                                               const blIntegerType& colIndex)const
 {
-    return this->at(rowIndex + m_roi.rowOffset(),colIndex + m_roi.colOffset());
+    return this->data()[roiDataIndex(rowIndex,colIndex)];
 }
 
 
@@ -403,15 +559,16 @@ inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const blIntegerType& rowIndex,
-                                                                                             const blIntegerType& colIndex,
-                                                                                             const blIntegerType& pageIndex)
+inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const blIntegerType& rowIndex,
+                                                                                                         const blIntegerType& colIndex,
+                                                                                                         const blIntegerType& pageIndex)
 {
-    return this->at(rowIndex + m_roi.rowOffset(),colIndex + m_roi.colOffset(),pageIndex + m_roi.pageOffset());
+    return this->data()[roiDataIndex(rowIndex,colIndex,pageIndex)];
 }
 
 
@@ -419,15 +576,16 @@ inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const blIntegerType& rowIndex,
-                                                                                                   const blIntegerType& colIndex,
-                                                                                                   const blIntegerType& pageIndex)const
+inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const blIntegerType& rowIndex,
+                                                                                                               const blIntegerType& colIndex,
+                                                                                                               const blIntegerType& pageIndex)const
 {
-    return this->at(rowIndex + m_roi.rowOffset(),colIndex + m_roi.colOffset(),pageIndex + m_roi.pageOffset());
+    return this->data()[roiDataIndex(rowIndex,colIndex,pageIndex)];
 }
 //-------------------------------------------------------------------
 
@@ -439,13 +597,14 @@ inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...Indexes>
 
-inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const Indexes&...dataIndexes)
+inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const Indexes&...dataIndexes)
 {
-    return this->roi_at({dataIndexes...});
+    return this->data()[roiDataIndex(dataIndexes...)];
 }
 
 
@@ -453,13 +612,14 @@ inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...Indexes>
 
-inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const Indexes&...dataIndexes)const
+inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const Indexes&...dataIndexes)const
 {
-    return this->roi_at({dataIndexes...});
+    return this->data()[roiDataIndex(dataIndexes...)];
 }
 
 
@@ -467,18 +627,14 @@ inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const std::initializer_list<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const std::initializer_list<blIntegerType>& dataIndexes)
 {
-    std::vector<std::size_t> offsettedDataIndexes(dataIndexes.begin(),dataIndexes.end());
-
-    for(std::size_t i = 0; i < offsettedDataIndexes.size(); ++i)
-        offsettedDataIndexes[i] += m_roi.offset(i);
-
-    return this->at(offsettedDataIndexes);
+    return this->data()[roiDataIndexOf(dataIndexes.begin(),dataIndexes.end())];
 }
 
 
@@ -486,18 +642,29 @@ inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const std::initializer_list<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const std::initializer_list<blIntegerType>& dataIndexes)const
 {
-    std::vector<std::size_t> offsettedDataIndexes(dataIndexes.begin(),dataIndexes.end());
+    return this->data()[roiDataIndexOf(dataIndexes.begin(),dataIndexes.end())];
+}
+
 
-    for(std::size_t i = 0; i < offsettedDataIndexes.size(); ++i)
-        offsettedDataIndexes[i] += m_roi.offset(i);
 
-    return this->at(offsettedDataIndexes);
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blIntegerType>
+
+inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const std::vector<blIntegerType>& dataIndexes)
+{
+    return this->data()[roiDataIndexOf(dataIndexes.begin(),dataIndexes.end())];
 }
 
 
@@ -505,18 +672,40 @@ inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfD
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const std::vector<blIntegerType>& dataIndexes)
+inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roi_at(const std::vector<blIntegerType>& dataIndexes)const
+{
+    return this->data()[roiDataIndexOf(dataIndexes.begin(),dataIndexes.end())];
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get the data index of
+// the ROI's first data point and of a data
+// point given its ROI coordinates
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roiOriginDataIndex()const
 {
-    std::vector<std::size_t> offsettedDataIndexes(dataIndexes.begin(),dataIndexes.end());
+    const auto& bufferUnitSizes = this->properties().sizesOfSingleUnits();
+
+    std::size_t originDataIndex = 0;
 
-    for(std::size_t i = 0; i < offsettedDataIndexes.size(); ++i)
-        offsettedDataIndexes[i] += m_roi.offset(i);
+    for(std::size_t i = 0; i < blMaxNumOfDimensions; ++i)
+        originDataIndex += m_roi.offset(i) * bufferUnitSizes[i];
 
-    return this->at(offsettedDataIndexes);
+    return originDataIndex;
 }
 
 
@@ -524,18 +713,49 @@ inline blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensi
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-template<typename blIntegerType>
+template<typename...Indexes>
 
-inline const blDataType& blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>::roi_at(const std::vector<blIntegerType>& dataIndexes)const
+inline std::size_t blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roiDataIndex(const Indexes&...dataIndexes)const
 {
-    std::vector<std::size_t> offsettedDataIndexes(dataIndexes.begin(),dataIndexes.end());
+    return roiOriginDataIndex() + this->linearIndex(dataIndexes...);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blIndexIteratorType>
+
+inline std::size_t blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>::roiDataIndexOf(blIndexIteratorType beginIndex,
+                                                                                                                   const blIndexIteratorType& endIndex)const
+{
+    // Each ROI coordinate is scaled by the
+    // buffer's cached size of a single unit
+    // of its dimension and added to the ROI's
+    // origin, passing more coordinates than
+    // the buffer has dimensions is a bug in
+    // the caller, caught by the assert in
+    // debug builds, while release builds
+    // ignore the extra coordinates
+
+    assert(static_cast<std::size_t>(std::distance(beginIndex,endIndex)) <= blMaxNumOfDimensions &&
+           "blBuffer_4::roi_at -- more indexes than the buffer has dimensions");
+
+    const auto& bufferUnitSizes = this->properties().sizesOfSingleUnits();
+
+    std::size_t bufferDataIndex = roiOriginDataIndex();
 
-    for(std::size_t i = 0; i < offsettedDataIndexes.size(); ++i)
-        offsettedDataIndexes[i] += m_roi.offset(i);
+    for(std::size_t i = 0; beginIndex != endIndex && i < blMaxNumOfDimensions; ++beginIndex, ++i)
+        bufferDataIndex += static_cast<std::size_t>(*beginIndex) * bufferUnitSizes[i];
 
-    return this->at(offsettedDataIndexes);
+    return bufferDataIndex;
 }
 //-------------------------------------------------------------------
 
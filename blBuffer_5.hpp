@@ -55,6 +55,13 @@
 
 #include "blRoiReverseIterator.hpp"
 
+
+
+// Include used to hand out
+// the ROI's contiguous runs
+
+#include "blSpan.hpp"
+
 //-------------------------------------------------------------------
 
 
@@ -75,16 +82,17 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-class blBuffer_5 : public blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>
+class blBuffer_5 : public blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>
 {
 public: // Public type aliases
 
 
 
-    using blBuffer_4_type = blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>;
-    using blBuffer_4_const_type = blBuffer_4<const blDataType,const blDataPtr,const blBufferPtr,blMaxNumOfDimensions>;
+    using blBuffer_4_type = blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>;
+    using blBuffer_4_const_type = blBuffer_4<const blDataType,const blDataPtr,const blBufferPtr,blMaxNumOfDimensions,blAllocator>;
 
 
 
@@ -110,7 +118,13 @@ public: // Constructors and destructors
 
     // Copy constructor
 
-    blBuffer_5(const blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>& buffer0) = default;
+    blBuffer_5(const blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer0) = default;
+
+
+
+    // Move constructor
+
+    blBuffer_5(blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer0) noexcept = default;
 
 
 
@@ -126,7 +140,13 @@ public: // Overloaded operators
 
     // Assignment operator
 
-    blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>&       operator=(const blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>& buffer0) = default;
+    blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&       operator=(const blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer0) = default;
+
+
+
+    // Move assignment operator
+
+    blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&       operator=(blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer0) = default;
 
 
 
@@ -175,6 +195,27 @@ public: // Public functions
 
 
 
+    // Segmented iteration over the ROI,
+    // the ROI is walked as a sequence of
+    // contiguous runs (see roiRunLength),
+    // each one handed out as a span so it
+    // can be processed with plain pointers
+    // (std::copy, std::fill, memcpy...)
+
+    std::size_t                                                             numberOfRoiRuns()const;
+
+    blSpan<blDataType>                                                      roiRun(const std::size_t& runIndex);
+
+    blSpan<const blDataType>                                                roiRun(const std::size_t& runIndex)const;
+
+    template<typename blFunctorType>
+    void                                                                    forEachRoiRun(blFunctorType&& functor);
+
+    template<typename blFunctorType>
+    void                                                                    forEachRoiRun(blFunctorType&& functor)const;
+
+
+
     // Circular ROI random access functions
 
     template<typename blIntegerType>
@@ -236,9 +277,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::blBuffer_5() : blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions>()
+inline blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_5() : blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAllocator>()
 {
 }
 //-------------------------------------------------------------------
@@ -252,9 +294,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::~blBuffer_5()
+inline blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::~blBuffer_5()
 {
 }
 //-------------------------------------------------------------------
@@ -268,9 +311,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_begin(const std::ptrdiff_t& maxNumberOfCirculations)
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_begin(const std::ptrdiff_t& maxNumberOfCirculations)
 {
     return roi_iterator(this,0,maxNumberOfCirculations);
 }
@@ -281,9 +325,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_end()
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_end()
 {
     return roi_iterator(this,this->roi().size(),0);
 }
@@ -294,9 +339,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_const_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_cbegin(const std::ptrdiff_t& maxNumberOfCirculations)const
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_const_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_cbegin(const std::ptrdiff_t& maxNumberOfCirculations)const
 {
     return roi_const_iterator(this,0,maxNumberOfCirculations);
 }
@@ -307,9 +353,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_const_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_cend()const
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_const_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_cend()const
 {
     return roi_const_iterator(this,this->roi().size(),0);
 }
@@ -324,9 +371,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_rbegin(const std::ptrdiff_t& maxNumberOfCirculations)
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_rbegin(const std::ptrdiff_t& maxNumberOfCirculations)
 {
     return roi_reverse_iterator(this,0,maxNumberOfCirculations);
 }
@@ -337,9 +385,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_rend()
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_rend()
 {
     return roi_reverse_iterator(this,this->roi().size(),0);
 }
@@ -350,9 +399,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_const_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_crbegin(const std::ptrdiff_t& maxNumberOfCirculations)const
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_const_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_crbegin(const std::ptrdiff_t& maxNumberOfCirculations)const
 {
     return roi_const_reverse_iterator(this,0,maxNumberOfCirculations);
 }
@@ -363,9 +413,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_const_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_crend()const
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_const_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_crend()const
 {
     return roi_const_reverse_iterator(this,this->roi().size(),0);
 }
@@ -383,10 +434,11 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_iter(const std::ptrdiff_t& startingPositionIndex,
-                                                                                                                                                                                                          const std::ptrdiff_t& maxNumberOfCirculations)
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_iter(const std::ptrdiff_t& startingPositionIndex,
+                                                                                                                                                                                                                                  const std::ptrdiff_t& maxNumberOfCirculations)
 {
     return roi_iterator(this,startingPositionIndex,maxNumberOfCirculations);
 }
@@ -397,10 +449,11 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_const_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_citer(const std::ptrdiff_t& startingPositionIndex,
-                                                                                                                                                                                                                 const std::ptrdiff_t& maxNumberOfCirculations)const
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_const_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_citer(const std::ptrdiff_t& startingPositionIndex,
+                                                                                                                                                                                                                                         const std::ptrdiff_t& maxNumberOfCirculations)const
 {
     return roi_const_iterator(this,startingPositionIndex,maxNumberOfCirculations);
 }
@@ -411,10 +464,11 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_riter(const std::ptrdiff_t& startingPositionIndex,
-                                                                                                                                                                                                                   const std::ptrdiff_t& maxNumberOfCirculations)
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_riter(const std::ptrdiff_t& startingPositionIndex,
+                                                                                                                                                                                                                                           const std::ptrdiff_t& maxNumberOfCirculations)
 {
     return roi_reverse_iterator(this,startingPositionIndex,maxNumberOfCirculations);
 }
@@ -425,10 +479,11 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_const_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::roi_criter(const std::ptrdiff_t& startingPositionIndex,
-                                                                                                                                                                                                                          const std::ptrdiff_t& maxNumberOfCirculations)const
+inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_const_reverse_iterator blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roi_criter(const std::ptrdiff_t& startingPositionIndex,
+                                                                                                                                                                                                                                                  const std::ptrdiff_t& maxNumberOfCirculations)const
 {
     return roi_const_reverse_iterator(this,startingPositionIndex,maxNumberOfCirculations);
 }
@@ -436,6 +491,114 @@ inline typename blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMax
 
 
 
+//-------------------------------------------------------------------
+// Functions used to walk the ROI one
+// contiguous run at a time
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::numberOfRoiRuns()const
+{
+    std::size_t runLength = this->roiRunLength();
+
+    if(runLength == 0)
+        return 0;
+
+    return this->roi().size() / runLength;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blSpan<blDataType> blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roiRun(const std::size_t& runIndex)
+{
+    std::size_t runLength = this->roiRunLength();
+
+    return blSpan<blDataType>(&this->roi_at(runIndex * runLength),runLength);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blSpan<const blDataType> blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::roiRun(const std::size_t& runIndex)const
+{
+    std::size_t runLength = this->roiRunLength();
+
+    return blSpan<const blDataType>(&this->roi_at(runIndex * runLength),runLength);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blFunctorType>
+
+inline void blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::forEachRoiRun(blFunctorType&& functor)
+{
+    // The run length is worked out once
+    // and each run's first data point is
+    // the only index decomposed per run
+
+    std::size_t runLength = this->roiRunLength();
+
+    if(runLength == 0)
+        return;
+
+    std::size_t numberOfRuns = this->roi().size() / runLength;
+
+    for(std::size_t runIndex = 0; runIndex < numberOfRuns; ++runIndex)
+        functor(blSpan<blDataType>(&this->roi_at(runIndex * runLength),runLength));
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blFunctorType>
+
+inline void blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::forEachRoiRun(blFunctorType&& functor)const
+{
+    std::size_t runLength = this->roiRunLength();
+
+    if(runLength == 0)
+        return;
+
+    std::size_t numberOfRuns = this->roi().size() / runLength;
+
+    for(std::size_t runIndex = 0; runIndex < numberOfRuns; ++runIndex)
+        functor(blSpan<const blDataType>(&this->roi_at(runIndex * runLength),runLength));
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // "circ_at" functions
 //-------------------------------------------------------------------
@@ -443,11 +606,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const blIntegerType& dataIndex)
+inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const blIntegerType& dataIndex)
 {
     return this->roi_at( this->circ_index(dataIndex,this->roi().size()) );
 }
@@ -458,11 +622,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const blIntegerType& dataIndex)const
+inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const blIntegerType& dataIndex)const
 {
     return this->roi_at( this->circ_index(dataIndex,this->roi().size()) );
 }
@@ -473,12 +638,13 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const blIntegerType &rowIndex,
-                                                                                                                 const blIntegerType &colIndex)
+inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const blIntegerType &rowIndex,
+                                                                                                                             const blIntegerType &colIndex)
 {
     return this->roi_at( this->circ_index(rowIndex,this->roi().rows()),
                          this->circ_index(colIndex,this->roi().cols()) );
@@ -490,12 +656,13 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const blIntegerType& rowIndex,
-                                                                                                                       const blIntegerType& colIndex)const
+inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const blIntegerType& rowIndex,
+                                                                                                                                   const blIntegerType& colIndex)const
 {
     return this->roi_at( this->circ_index(rowIndex,this->roi().rows()),
                          this->circ_index(colIndex,this->roi().cols()) );
@@ -507,13 +674,14 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const blIntegerType& rowIndex,
-                                                                                                                 const blIntegerType& colIndex,
-                                                                                                                 const blIntegerType& pageIndex)
+inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const blIntegerType& rowIndex,
+                                                                                                                             const blIntegerType& colIndex,
+                                                                                                                             const blIntegerType& pageIndex)
 {
     return this->roi_at( this->circ_index(rowIndex,this->roi().rows()),
                          this->circ_index(colIndex,this->roi().cols()),
@@ -526,13 +694,14 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const blIntegerType& rowIndex,
-                                                                                                                       const blIntegerType& colIndex,
-                                                                                                                       const blIntegerType& pageIndex)const
+inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const blIntegerType& rowIndex,
+                                                                                                                                   const blIntegerType& colIndex,
+                                                                                                                                   const blIntegerType& pageIndex)const
 {
     return this->roi_at( this->circ_index(rowIndex,this->roi().rows()),
                          this->circ_index(colIndex,this->roi().cols()),
@@ -549,11 +718,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...Indexes>
 
-inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const Indexes&...dataIndexes)
+inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const Indexes&...dataIndexes)
 {
     return this->circ_at({dataIndexes...});
 }
@@ -564,11 +734,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...Indexes>
 
-inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const Indexes&...dataIndexes)const
+inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const Indexes&...dataIndexes)const
 {
     return this->circ_at({dataIndexes...});
 }
@@ -579,11 +750,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const std::initializer_list<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const std::initializer_list<blIntegerType>& dataIndexes)
 {
     std::vector<std::size_t> offsettedAndCirculatedDataIndexes(dataIndexes.begin(),dataIndexes.end());
 
@@ -599,11 +771,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const std::initializer_list<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const std::initializer_list<blIntegerType>& dataIndexes)const
 {
     std::vector<std::size_t> offsettedAndCirculatedDataIndexes(dataIndexes.begin(),dataIndexes.end());
 
@@ -619,11 +792,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const std::vector<blIntegerType>& dataIndexes)
+inline blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const std::vector<blIntegerType>& dataIndexes)
 {
     std::vector<std::size_t> offsettedAndCirculatedDataIndexes(dataIndexes.begin(),dataIndexes.end());
 
@@ -639,11 +813,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circ_roi_at(const std::vector<blIntegerType>& dataIndexes)const
+inline const blDataType& blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circ_roi_at(const std::vector<blIntegerType>& dataIndexes)const
 {
     std::vector<std::size_t> offsettedAndCirculatedDataIndexes(dataIndexes.begin(),dataIndexes.end());
 
@@ -11,6 +11,30 @@
 //                     create functions used to create/initialize
 //                     the buffer
 //
+//                  -- The buffer can be created in mirrored memory,
+//                     where the data is mapped twice back to back so
+//                     that any window of up to size() data points
+//                     starting anywhere in the ring is contiguous
+//
+//                  -- The buffer can also ask for its data to be backed
+//                     by huge pages (explicit or transparent), falling back
+//                     to regular pages when they're not available
+//
+//                  -- The buffer can prefault its data (optionally across
+//                     threads) and lock it in memory when it's created,
+//                     so that the writer's first pass doesn't take page
+//                     faults
+//
+//                  -- The buffer can leave trivial data types
+//                     uninitialized when it's created, and fill
+//                     its data across threads when asked to
+//
+//                  -- The buffer can be given an instance of its allocator
+//                     (an arena or a pool for example) before it's created
+//
+//                  -- The buffer's dimensions can be padded so that
+//                     every column (or page) starts aligned
+//
 //                  -- This class is defined within the blBufferLIB
 //                     namespace
 //
@@ -33,6 +57,13 @@
 
 #include "blRoiIterator.hpp"
 
+#include <memory>
+#include <type_traits>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <numeric>
+
 //-------------------------------------------------------------------
 
 
@@ -46,6 +77,62 @@ namespace blBufferLIB
 
 
 
+//-------------------------------------------------------------------
+// Enumeration used to choose how the
+// buffer allocates its data
+//
+// -- CONTIGUOUS: The data is held in
+//                a regular vector
+//
+// -- MIRRORED:   The data is held in memory
+//                mapped twice back to back,
+//                so that data()[i + size()]
+//                is data()[i] and data wrapping
+//                around the end of the ring can
+//                be accessed as one span
+//
+//                The data type has to be trivially
+//                copyable and the buffer has to be
+//                a whole number of pages, otherwise
+//                the buffer falls back to CONTIGUOUS
+//                (use isMirrored() to check)
+//-------------------------------------------------------------------
+enum class blAllocationMode
+{
+    CONTIGUOUS,
+    MIRRORED
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Enumeration used to choose how the
+// buffer initializes its data
+//
+// -- VALUE_INITIALIZED: Every data point is
+//                       value initialized
+//                       (zeroed for trivial
+//                       data types)
+//
+// -- UNINITIALIZED:     Trivially default
+//                       constructible data
+//                       points are left as
+//                       they are, which saves
+//                       touching every page
+//                       of a big buffer (any
+//                       other data type is
+//                       still constructed)
+//-------------------------------------------------------------------
+enum class blInitializationMode
+{
+    VALUE_INITIALIZED,
+    UNINITIALIZED
+};
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // class blBuffer_6 declaration
 //-------------------------------------------------------------------
@@ -53,9 +140,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-class blBuffer_6 : public blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>
+class blBuffer_6 : public blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>
 {
 public: // Constructors and destructors
 
@@ -67,9 +155,19 @@ public: // Constructors and destructors
 
 
 
-    // Copy constructor
+    // Copy constructor (the copy gets the
+    // source's options and its own copy of
+    // the data, locked in memory if the
+    // source's data was)
+
+    blBuffer_6(const blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer6);
+
+
+
+    // Move constructor (the data
+    // and its lock are transferred)
 
-    blBuffer_6(const blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>& buffer6) = default;
+    blBuffer_6(blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer6) noexcept;
 
 
 
@@ -83,9 +181,16 @@ public: // Overloaded operators
 
 
 
-    // Assignment operator
+    // Assignment operator (same
+    // as the copy constructor)
 
-    blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>&   operator=(const blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>& buffer6) = default;
+    blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&   operator=(const blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer6);
+
+
+
+    // Move assignment operator
+
+    blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&   operator=(blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer6) noexcept(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMoveAssignmentNoexcept);
 
 
 
@@ -125,12 +230,218 @@ public: // Create functions used to
 
 
 
+    // Functions used to get/set how the
+    // buffer allocates its data the next
+    // time it's created
+
+    const blAllocationMode&                                                 allocationMode()const;
+    void                                                                    setAllocationMode(const blAllocationMode& allocationMode);
+
+
+
+    // Functions used to get/set the type
+    // of pages the buffer asks for the next
+    // time it's created
+    //
+    // -- Huge pages need a trivially destructible
+    //    data type (mirrored buffers a whole number
+    //    of huge pages for explicit huge pages),
+    //    otherwise the buffer falls back to the
+    //    next type of pages (use sizeOfPages() to
+    //    know which pages backed the data)
+
+    const blPageType&                                                       pageType()const;
+    void                                                                    setPageType(const blPageType& pageType);
+
+
+
+    // Functions used to get/set the instance
+    // of the allocator used by the buffer's
+    // data vector
+    //
+    // -- Setting the allocator releases the data
+    //    the buffer holds in its vector, so it's
+    //    meant to be called before creating the
+    //    buffer
+
+    typename blBuffer_6::allocator_type                                     allocator()const;
+    void                                                                    setAllocator(const typename blBuffer_6::allocator_type& allocator);
+
+
+
+    // Functions used to get/set how the
+    // buffer initializes its data the next
+    // time it's created
+
+    const blInitializationMode&                                             initializationMode()const;
+    void                                                                    setInitializationMode(const blInitializationMode& initializationMode);
+
+
+
+    // Function used to set every data
+    // point of the buffer to the specified
+    // value, splitting the work across
+    // the specified number of threads
+    // (the calling thread being one of
+    // them)
+
+    void                                                                    fill(const blDataType& value,
+                                                                                 const std::size_t& numberOfThreads = 1);
+
+
+
+    // Function used to pad a dimension so
+    // that its pitch in bytes is a multiple
+    // of the specified alignment the next
+    // time the buffer is created
+    //
+    // -- Aligning the first dimension to 64
+    //    bytes makes every column of an image
+    //    start on a cache line, since the data
+    //    itself is aligned to BL_BUFFER_DATA_ALIGNMENT
+    //    bytes (or to a page when it's mapped)
+    //
+    // -- An alignment of one removes the padding
+
+    const std::size_t&                                                      pitchAlignment(const std::size_t& whichDimension)const;
+    void                                                                    setPitchAlignment(const std::size_t& whichDimension,
+                                                                                              const std::size_t& alignmentInBytes);
+
+
+
+    // Functions used to get/set whether the
+    // buffer prefaults its data when it's
+    // created, and with how many threads
+
+    const bool&                                                             shouldPrefault()const;
+    const std::size_t&                                                      numberOfPrefaultingThreads()const;
+    void                                                                    setPrefault(const bool& shouldPrefault,
+                                                                                        const std::size_t& numberOfPrefaultingThreads = 1);
+
+
+
+    // Functions used to get/set whether the
+    // buffer locks its data in memory (mlock)
+    // when it's created, and whether it did
+    // (locking fails when the data is bigger
+    // than RLIMIT_MEMLOCK allows)
+
+    const bool&                                                             shouldLockInMemory()const;
+    void                                                                    setLockInMemory(const bool& shouldLockInMemory);
+
+    const bool&                                                             isLockedInMemory()const;
+
+
+
+    // Function used to get how long it
+    // took to prefault and lock the data
+    // the last time the buffer was created
+
+    const std::chrono::nanoseconds&                                         prefaultDuration()const;
+
+
+
+    // Function used to set all the options
+    // above back to their defaults, unlocking
+    // the data if it's locked in memory
+    //
+    // -- The data itself is left as is, the
+    //    options only apply the next time the
+    //    buffer is created
+
+    void                                                                    resetOptions();
+
+
+
+protected: // Protected functions
+
+
+
+    // Functions used to prefault and lock
+    // the buffer's data (as asked by the
+    // user) right after it's been allocated
+    // or attached to, and to unlock it
+    // before it gets released
+    //
+    // The data is only written to while
+    // prefaulting if nobody else can be
+    // using it yet
+
+    void                                                                    prefaultAndLockData(const bool& canTouchData);
+    void                                                                    unlockData();
+
+
+
+    // Function used to pad the buffer's
+    // dimensions as asked by the user
+    // right before it gets allocated
+
+    void                                                                    applyPitchAlignments();
+
+
+
+private: // Private functions
+
+
+
+    // Functions used by the copy and move
+    // operations to copy the source's options
+    // and to take over the source's options
+    // and the lock on the data just stolen
+    // from it
+
+    void                                                                    copyOptionsFrom(const blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer6);
+    void                                                                    takeOptionsAndLockFrom(blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer6);
+
+
+
 private: // Create function that does the
          // actual work of allocating memory
          // This function gets called by the
          // other create functions
 
     bool                                                                    create();
+
+
+
+private: // Private variables
+
+
+
+    // How the buffer allocates its data
+    // and the type of pages it asks for
+
+    blAllocationMode                                                        m_allocationMode;
+    blPageType                                                              m_pageType;
+    blInitializationMode                                                    m_initializationMode;
+
+
+
+    // The pitch alignments (in bytes)
+    // applied to each dimension the
+    // next time the buffer is created
+
+    std::array<std::size_t,blMaxNumOfDimensions>                            m_pitchAlignments;
+
+
+
+    // The prefaulting and locking
+    // options and results
+
+    bool                                                                    m_shouldPrefault;
+    std::size_t                                                             m_numberOfPrefaultingThreads;
+
+    bool                                                                    m_shouldLockInMemory;
+    bool                                                                    m_isLockedInMemory;
+
+    // The span that was locked, kept since
+    // the buffer's sizes can change before
+    // it gets unlocked
+
+    void*                                                                   m_lockedData;
+    std::size_t                                                             m_numberOfLockedBytes;
+
+    std::chrono::nanoseconds                                                m_prefaultDuration;
 };
 //-------------------------------------------------------------------
 
@@ -143,10 +454,65 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_6() : blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>()
+{
+    m_isLockedInMemory = false;
+
+    m_lockedData = nullptr;
+    m_numberOfLockedBytes = 0;
+
+    resetOptions();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_6(const blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer6) : blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>(buffer6)
+{
+    copyOptionsFrom(buffer6);
+
+
+
+    // Nobody else can be using
+    // our copy of the data yet
+
+    m_isLockedInMemory = false;
+    m_lockedData = nullptr;
+    m_numberOfLockedBytes = 0;
+
+    if(buffer6.m_isLockedInMemory && this->doesBufferOwnData())
+        prefaultAndLockData(true);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Move constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::blBuffer_6() : blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>()
+inline blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_6(blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer6) noexcept : blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>(std::move(buffer6))
 {
+    takeOptionsAndLockFrom(buffer6);
 }
 //-------------------------------------------------------------------
 
@@ -159,10 +525,151 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::~blBuffer_6()
+{
+    unlockData();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::operator=(const blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer6)
+{
+    if(this == &buffer6)
+        return (*this);
+
+
+
+    // Our data is about to be
+    // released, so we unlock it first
+
+    unlockData();
+
+    blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::operator=(buffer6);
+
+    copyOptionsFrom(buffer6);
+
+    if(buffer6.m_isLockedInMemory && this->doesBufferOwnData())
+        prefaultAndLockData(true);
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Move assignment operator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::operator=(blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer6) noexcept(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMoveAssignmentNoexcept)
+{
+    if(this == &buffer6)
+        return (*this);
+
+
+
+    // Our data is about to be
+    // released, so we unlock it first
+
+    unlockData();
+
+    blBuffer_5<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::operator=(std::move(buffer6));
+
+    takeOptionsAndLockFrom(buffer6);
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used by the copy and move operations
+// to copy the source's options and to take over
+// the lock on the data just stolen from it
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::copyOptionsFrom(const blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer6)
+{
+    m_allocationMode = buffer6.m_allocationMode;
+    m_pageType = buffer6.m_pageType;
+    m_initializationMode = buffer6.m_initializationMode;
+
+    m_pitchAlignments = buffer6.m_pitchAlignments;
+
+    m_shouldPrefault = buffer6.m_shouldPrefault;
+    m_numberOfPrefaultingThreads = buffer6.m_numberOfPrefaultingThreads;
+
+    m_shouldLockInMemory = buffer6.m_shouldLockInMemory;
+
+    m_prefaultDuration = buffer6.m_prefaultDuration;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::~blBuffer_6()
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::takeOptionsAndLockFrom(blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer6)
 {
+    copyOptionsFrom(buffer6);
+
+
+
+    // The lock stays with the data as
+    // long as the data kept its address
+    // (a data vector with a different
+    // allocator might have had to move
+    // its data points elsewhere)
+
+    if(buffer6.m_isLockedInMemory && buffer6.m_lockedData == static_cast<void*>(this->dataBytes()))
+    {
+        m_isLockedInMemory = true;
+        m_lockedData = buffer6.m_lockedData;
+        m_numberOfLockedBytes = buffer6.m_numberOfLockedBytes;
+
+        buffer6.m_isLockedInMemory = false;
+        buffer6.m_lockedData = nullptr;
+        buffer6.m_numberOfLockedBytes = 0;
+    }
+    else
+    {
+        m_isLockedInMemory = false;
+        m_lockedData = nullptr;
+        m_numberOfLockedBytes = 0;
+
+        buffer6.unlockData();
+    }
 }
 //-------------------------------------------------------------------
 
@@ -176,11 +683,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename...blIntegerType>
 
-inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::create(const blIntegerType&...bufferLengths)
+inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::create(const blIntegerType&...bufferLengths)
 {
     this->m_properties.setDimensionalSizes({static_cast<std::size_t>(bufferLengths)...});
 
@@ -193,11 +701,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::create(const std::initializer_list<blIntegerType>& bufferLengths)
+inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::create(const std::initializer_list<blIntegerType>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
 
@@ -210,11 +719,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType>
 
-inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::create(const std::vector<blIntegerType>& bufferLengths)
+inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::create(const std::vector<blIntegerType>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
 
@@ -227,12 +737,13 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blIntegerType,
          std::size_t blNumberOfDimensions>
 
-inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::create(const std::array<blIntegerType,blNumberOfDimensions>& bufferLengths)
+inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::create(const std::array<blIntegerType,blNumberOfDimensions>& bufferLengths)
 {
     this->m_properties.setDimensionalSizes(bufferLengths);
 
@@ -249,15 +760,101 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::create()
+inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::create()
 {
-    // First we try to allocate the
-    // requested space
+    // Mirrored buffers hold their data in
+    // mirrored memory when the data type
+    // and the size allow it, the data is
+    // zeroed by the system
+
+    unlockData();
+
+    applyPitchAlignments();
+
+    this->m_mirroredData.release();
+    this->m_mappedData.release();
+
+    if constexpr(std::is_trivially_copyable<blDataType>::value)
+    {
+        if(m_allocationMode == blAllocationMode::MIRRORED &&
+           this->m_mirroredData.allocate(this->size() * sizeof(blDataType),m_pageType))
+        {
+            this->m_data.clear();
+            this->m_data.shrink_to_fit();
+
+            if constexpr(!std::is_trivially_default_constructible<blDataType>::value)
+            {
+                if(m_initializationMode == blInitializationMode::VALUE_INITIALIZED)
+                    std::uninitialized_value_construct_n(static_cast<blDataType*>(this->m_mirroredData.data()),this->size());
+                else
+                    std::uninitialized_default_construct_n(static_cast<blDataType*>(this->m_mirroredData.data()),this->size());
+            }
+
+            this->resetDataPointers();
+            this->resetROI();
+
+            prefaultAndLockData(true);
+
+            return true;
+        }
+    }
+
+
+
+    // Buffers asking for huge pages map
+    // their data directly (the mapped
+    // memory never runs destructors)
+
+    if constexpr(std::is_trivially_destructible<blDataType>::value)
+    {
+        if(m_pageType != blPageType::REGULAR &&
+           this->m_mappedData.allocate(this->size() * sizeof(blDataType),m_pageType))
+        {
+            this->m_data.clear();
+            this->m_data.shrink_to_fit();
+
+            if constexpr(!std::is_trivially_default_constructible<blDataType>::value)
+            {
+                if(m_initializationMode == blInitializationMode::VALUE_INITIALIZED)
+                    std::uninitialized_value_construct_n(static_cast<blDataType*>(this->m_mappedData.data()),this->size());
+                else
+                    std::uninitialized_default_construct_n(static_cast<blDataType*>(this->m_mappedData.data()),this->size());
+            }
+
+            this->resetDataPointers();
+            this->resetROI();
+
+            prefaultAndLockData(true);
+
+            return true;
+        }
+    }
+
+
+
+    // Otherwise we try to allocate
+    // the requested space in the
+    // data vector, whose allocator
+    // leaves new trivial data points
+    // uninitialized, so we zero them
+    // ourselves unless asked not to
+
+    std::size_t previousSizeOfData = this->m_data.size();
 
     this->m_data.resize(this->size());
 
+    if constexpr(std::is_trivially_default_constructible<blDataType>::value)
+    {
+        if(m_initializationMode == blInitializationMode::VALUE_INITIALIZED &&
+           this->m_data.size() > previousSizeOfData)
+        {
+            std::fill(this->m_data.begin() + previousSizeOfData,this->m_data.end(),blDataType());
+        }
+    }
+
 
 
     // Check to make sure we succeded
@@ -292,6 +889,13 @@ inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumO
 
 
 
+    // Nobody else can be using the
+    // data vector yet
+
+    prefaultAndLockData(true);
+
+
+
     // Let's not forget to let
     // the user know whether the
     // create function failed to
@@ -303,6 +907,470 @@ inline bool blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumO
 
 
 
+//-------------------------------------------------------------------
+// Functions used to get/set the allocation mode
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const blAllocationMode& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::allocationMode()const
+{
+    return m_allocationMode;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setAllocationMode(const blAllocationMode& allocationMode)
+{
+    m_allocationMode = allocationMode;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the type of pages
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const blPageType& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::pageType()const
+{
+    return m_pageType;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setPageType(const blPageType& pageType)
+{
+    m_pageType = pageType;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the allocator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline typename blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::allocator_type blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::allocator()const
+{
+    return this->m_data.get_allocator();
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setAllocator(const typename blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::allocator_type& allocator)
+{
+    // If the buffer's data is held in the
+    // vector we let go of it first
+
+    bool isDataInVector = (!this->m_data.empty() && this->ownedData() == this->m_data.data());
+
+    if(isDataInVector)
+        unlockData();
+
+
+
+    // The vector's allocator can't be
+    // replaced, so we replace the vector
+
+    using data_vector_type = decltype(this->m_data);
+
+    this->m_data.~data_vector_type();
+
+    new(&this->m_data) data_vector_type(typename data_vector_type::allocator_type(allocator));
+
+
+
+    if(isDataInVector)
+    {
+        this->m_properties.setDimensionalSizes();
+        this->resetDataPointers();
+        this->resetROI();
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the initialization mode
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const blInitializationMode& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::initializationMode()const
+{
+    return m_initializationMode;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setInitializationMode(const blInitializationMode& initializationMode)
+{
+    m_initializationMode = initializationMode;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to fill the buffer's data across threads
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::fill(const blDataType& value,
+                                                                                                               const std::size_t& numberOfThreads)
+{
+    if(this->size() == 0)
+        return;
+
+
+
+    // Each thread gets one contiguous
+    // part of the data (the mirrored
+    // view of a mirrored buffer is
+    // filled along with the data)
+
+    blDataType* beginningOfData = &(this->data()[0]);
+
+    std::size_t numberOfParts = std::max<std::size_t>(1,std::min(numberOfThreads,this->size()));
+    std::size_t sizeOfParts = (this->size() + numberOfParts - 1) / numberOfParts;
+
+    auto fillPart = [&](const std::size_t& whichPart)
+    {
+        std::size_t beginningOfPart = std::min(this->size(),whichPart * sizeOfParts);
+        std::size_t endOfPart = std::min(this->size(),beginningOfPart + sizeOfParts);
+
+        std::fill(beginningOfData + beginningOfPart,beginningOfData + endOfPart,value);
+    };
+
+
+
+    std::vector<std::thread> fillingThreads;
+
+    for(std::size_t whichPart = 1; whichPart < numberOfParts; ++whichPart)
+        fillingThreads.emplace_back(fillPart,whichPart);
+
+    fillPart(0);
+
+    for(auto& fillingThread : fillingThreads)
+        fillingThread.join();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to pad the dimensions to alignments
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setPitchAlignment(const std::size_t& whichDimension,
+                                                                                                                            const std::size_t& alignmentInBytes)
+{
+    m_pitchAlignments[whichDimension] = (alignmentInBytes == 0 ? std::size_t(1) : alignmentInBytes);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const std::size_t& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::pitchAlignment(const std::size_t& whichDimension)const
+{
+    return m_pitchAlignments[whichDimension];
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::applyPitchAlignments()
+{
+    // The properties' pitch alignments
+    // are in data points, the smallest
+    // number of which spans a multiple
+    // of the requested number of bytes
+
+    for(std::size_t i = 0; i < blMaxNumOfDimensions; ++i)
+        this->m_properties.setPitchAlignment(i,m_pitchAlignments[i] / std::gcd(m_pitchAlignments[i],sizeof(blDataType)));
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the prefaulting
+// and locking options and results
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const bool& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::shouldPrefault()const
+{
+    return m_shouldPrefault;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const std::size_t& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::numberOfPrefaultingThreads()const
+{
+    return m_numberOfPrefaultingThreads;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setPrefault(const bool& shouldPrefault,
+                                                                                                                      const std::size_t& numberOfPrefaultingThreads)
+{
+    m_shouldPrefault = shouldPrefault;
+    m_numberOfPrefaultingThreads = std::max<std::size_t>(1,numberOfPrefaultingThreads);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const bool& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::shouldLockInMemory()const
+{
+    return m_shouldLockInMemory;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setLockInMemory(const bool& shouldLockInMemory)
+{
+    m_shouldLockInMemory = shouldLockInMemory;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const bool& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::isLockedInMemory()const
+{
+    return m_isLockedInMemory;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const std::chrono::nanoseconds& blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::prefaultDuration()const
+{
+    return m_prefaultDuration;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to set the options back to their defaults
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::resetOptions()
+{
+    unlockData();
+
+    m_allocationMode = blAllocationMode::CONTIGUOUS;
+    m_pageType = blPageType::REGULAR;
+    m_initializationMode = blInitializationMode::VALUE_INITIALIZED;
+
+    for(auto& i : m_pitchAlignments)
+        i = 1;
+
+    m_shouldPrefault = false;
+    m_numberOfPrefaultingThreads = 1;
+
+    m_shouldLockInMemory = false;
+
+    m_prefaultDuration = std::chrono::nanoseconds(0);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to prefault, lock and unlock the data
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::prefaultAndLockData(const bool& canTouchData)
+{
+    m_prefaultDuration = std::chrono::nanoseconds(0);
+
+    if(this->size() == 0 || (!m_shouldPrefault && !m_shouldLockInMemory))
+        return;
+
+
+
+    // A mirrored buffer's second copy
+    // maps the same pages, but it still
+    // needs its own page table entries
+
+    void* data = static_cast<void*>(&(this->data()[0]));
+
+    std::size_t numberOfBytes = this->size() * sizeof(blDataType) * (this->isMirrored() ? 2 : 1);
+
+
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    if(m_shouldPrefault)
+        blMappedMemory::prefault(data,numberOfBytes,m_numberOfPrefaultingThreads,canTouchData);
+
+    if(m_shouldLockInMemory && blMappedMemory::lock(data,numberOfBytes))
+    {
+        m_isLockedInMemory = true;
+        m_lockedData = data;
+        m_numberOfLockedBytes = numberOfBytes;
+    }
+
+    m_prefaultDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::unlockData()
+{
+    if(!m_isLockedInMemory)
+        return;
+
+    blMappedMemory::unlock(m_lockedData,m_numberOfLockedBytes);
+
+    m_isLockedInMemory = false;
+    m_lockedData = nullptr;
+    m_numberOfLockedBytes = 0;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // End of namespace
 }
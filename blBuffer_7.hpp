@@ -35,6 +35,42 @@
 //                        this very buffer, again with the option to
 //                        wait or to not wait
 //
+//                     -- Every write publishes a monotonically increasing
+//                        write sequence (with release semantics) which
+//                        readers observe (with acquire semantics) to
+//                        know how much data has been fully written
+//
+//                     -- The buffer can be switched into a "single writer"
+//                        mode, in which the write functions skip the
+//                        atomic flag entirely and the write hot path has
+//                        no read-modify-write operations at all
+//
+//                     -- The buffer can also be switched into a "multiple
+//                        writers" mode, in which each writer claims its own
+//                        disjoint range of the buffer with a single atomic
+//                        fetch_add, copies its data in parallel with the
+//                        other writers and then commits its range in order,
+//                        so that readers only ever see fully written ranges
+//
+//                     -- Writers that have to wait for their turn do so
+//                        using a pluggable wait strategy (busy spin, spin
+//                        then yield, or spin/yield then park on a futex)
+//                        selectable per buffer, which also keeps track of
+//                        how long writers waited
+//
+//                     -- The "reserve" and "commit" functions let a writer
+//                        write straight into the buffer's memory, reserve
+//                        returns up to two writable spans (the tail end
+//                        of the buffer and the part that wraps around to
+//                        its beginning) and commit publishes them
+//
+//                     -- The buffer keeps the registry of its readers'
+//                        cursors (see blReaderRegistry.hpp), so that the
+//                        writers can apply an overrun policy: overwrite
+//                        the oldest data (the default), block until the
+//                        slowest reader frees enough room, or fail the
+//                        write and count it
+//
 //                  -- This class is defined within the blBufferLIB
 //                     namespace
 //
@@ -60,6 +96,33 @@
 // by another thread
 
 #include <atomic>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+
+
+// Used by writers waiting
+// for their turn to write
+
+#include "blWaitStrategy.hpp"
+
+
+
+// Used to hand out writable
+// regions of the buffer
+
+#include "blSpan.hpp"
+
+
+
+// Used to hold the state shared
+// by writers and readers, including
+// the readers' cursors
+
+#include "blRingControlBlock.hpp"
 
 //-------------------------------------------------------------------
 
@@ -74,6 +137,98 @@ namespace blBufferLIB
 
 
 
+//-------------------------------------------------------------------
+// Enumeration used to choose how the write functions
+// synchronize the threads writing to the buffer
+//-------------------------------------------------------------------
+enum class blWriteMode
+{
+    // Any thread can write, writers take
+    // turns by acquiring the atomic flag
+    // "m_isBufferBeingCurrentlyWrittenTo"
+    // (This is the default mode)
+
+    LOCKED_WRITERS,
+
+
+
+    // Only one thread ever writes to the
+    // buffer (SPSC/SPMC), so writes do
+    // not touch the atomic flag and just
+    // publish the write sequence
+
+    SINGLE_WRITER,
+
+
+
+    // Any thread can write, each writer
+    // claims a disjoint range of the buffer
+    // with one atomic fetch_add, copies its
+    // data in parallel with the other writers
+    // and then commits its range in the same
+    // order the ranges were claimed
+
+    MULTIPLE_WRITERS
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Enumeration used to choose what writers do when
+// writing would overwrite data a registered reader
+// has not read yet
+//-------------------------------------------------------------------
+enum class blOverrunPolicy
+{
+    // The oldest data is overwritten and
+    // lapped readers skip ahead past it
+    // (This is the default policy)
+
+    OVERWRITE,
+
+
+
+    // Writers wait (using the writers
+    // wait strategy) until the slowest
+    // reader frees enough room
+
+    BLOCK,
+
+
+
+    // Writes that don't fit are dropped
+    // and counted as failed writes
+
+    FAIL
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// A write reservation holds the (up to two)
+// writable spans handed out by the "reserve"
+// function and the write sequence at which
+// they start
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blWriteReservation : public blSpanPair<blDataType>
+{
+public: // Public variables
+
+
+
+    // The write sequence of the
+    // first reserved data point
+
+    std::uint64_t                                           m_sequence = 0;
+};
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // class blBuffer_7 declaration
 //-------------------------------------------------------------------
@@ -81,16 +236,19 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-class blBuffer_7 : public blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>
+class blBuffer_7 : public blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>
 {
 public: // Public type aliases
 
 
 
-    using circular_iterator = typename blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circular_iterator;
-    using circular_const_iterator = typename blBuffer_6<blDataType,const blDataPtr,const blBufferPtr,const blBufferRoiPtr,blMaxNumOfDimensions>::circular_const_iterator;
+    using circular_iterator = typename blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circular_iterator;
+    using circular_const_iterator = typename blBuffer_6<blDataType,const blDataPtr,const blBufferPtr,const blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circular_const_iterator;
+
+    using reader_registry = blRingControlBlock::reader_registry;
 
 
 
@@ -104,9 +262,20 @@ public: // Constructors and destructors
 
 
 
-    // Copy constructor
+    // Copy constructor (the copy gets a
+    // control block of its own, starting
+    // where the source's writers are, but
+    // with none of the source's readers)
+
+    blBuffer_7(const blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer7);
+
 
-    blBuffer_7(const blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>& buffer7) = default;
+
+    // Move constructor (the control
+    // block, and with it the readers'
+    // cursors, moves along with the data)
+
+    blBuffer_7(blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer7) noexcept;
 
 
 
@@ -120,9 +289,16 @@ public: // Overloaded operators
 
 
 
-    // Assignment operator
+    // Assignment operator (same
+    // as the copy constructor)
+
+    blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&    operator=(const blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer7);
+
 
-    blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>&    operator=(const blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>& buffer7) = default;
+
+    // Move assignment operator
+
+    blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&    operator=(blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer7) noexcept(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMoveAssignmentNoexcept);
 
 
 
@@ -138,6 +314,102 @@ public: // Public functions
 
 
 
+    // Functions used to get/set the
+    // mode used to synchronize writers
+    //
+    // NOTE: The write mode should be set
+    //       before any thread starts writing
+
+    const blWriteMode&                                                      writeMode()const;
+    void                                                                    setWriteMode(const blWriteMode& writeMode);
+
+
+
+    // Functions used to get/set the policy
+    // applied when a write would overwrite
+    // data a registered reader hasn't read
+    // yet, and to get the number of writes
+    // dropped because they didn't fit
+    //
+    // NOTE: -- With the blocking and failing
+    //          policies a single write can't be
+    //          bigger than the buffer, such writes
+    //          always fail
+    //
+    //       -- Only registered readers hold the
+    //          writers back, without any readers
+    //          the buffer just gets overwritten
+    //
+    //       -- The "no_wait" write functions
+    //          never block, they drop the write
+    //          instead
+
+    const blOverrunPolicy&                                                  overrunPolicy()const;
+    void                                                                    setOverrunPolicy(const blOverrunPolicy& overrunPolicy);
+
+    std::uint64_t                                                           numberOfFailedWrites()const;
+
+
+
+    // This function returns the published
+    // write sequence, that is the buffer
+    // position (counted from the start,
+    // without wrapping) up to which data
+    // has been fully written
+    //
+    // It is loaded with acquire semantics,
+    // so any data point before this position
+    // can be safely read by another thread
+
+    std::uint64_t                                                           publishedWriteSequence()const;
+
+
+
+    // Functions used to choose the
+    // strategy used by writers that
+    // have to wait for their turn and
+    // by readers waiting for data, and
+    // to get a hold of them, for example
+    // to tune their limits or check how
+    // long threads waited
+    //
+    // NOTE: Publishing never costs the
+    //       writer a memory fence, with the
+    //       parking strategy the writer only
+    //       does a relaxed check of the lowest
+    //       reader watermark and parked readers
+    //       it misses re-check their condition
+    //       within "blWaitStrategy::maxParkTime"
+
+    void                                                                    setWaitStrategy(const blWaitStrategyType& waitStrategyType);
+
+    blWaitStrategy&                                                         writersWaitStrategy();
+    const blWaitStrategy&                                                   writersWaitStrategy()const;
+
+    blWaitStrategy&                                                         readersWaitStrategy();
+    const blWaitStrategy&                                                   readersWaitStrategy()const;
+
+
+
+    // Function used to reset the ring as
+    // if the buffer was just created, it
+    // drops all the registered readers,
+    // rewinds the write sequence to the
+    // start of the data and sets the write
+    // mode, overrun policy and wait strategies
+    // back to their defaults
+    //
+    // -- The data itself is left as is
+    //
+    // -- A buffer sharing another's control
+    //    block (for example in shared memory)
+    //    keeps using it untouched, only its
+    //    own settings are reset
+
+    void                                                                    resetRing();
+
+
+
     // The following functions can be used to
     // write from a specified variable or buffer
     // into this buffer
@@ -221,6 +493,242 @@ public: // Public functions
 
 
 
+    // Zero-copy write functions
+    //
+    // -- reserve(n) returns up to two spans
+    //    pointing straight into the buffer
+    //    memory (never more than the buffer
+    //    size worth of data points) where the
+    //    caller can write its data
+    //
+    // -- commit(n) then publishes the first
+    //    n data points of the reservation
+    //
+    // -- In the locked writers mode, reserve
+    //    waits for the writers lock and commit
+    //    releases it, so every non-empty
+    //    reservation has to be committed
+    //
+    // -- An empty reservation (nothing asked
+    //    for, or the overrun policy didn't let
+    //    us write) holds nothing, committing it
+    //    with commit(reservation) does nothing
+    //
+    // -- In the multiple writers mode reserve
+    //    claims the whole range, which has to
+    //    be committed entirely by passing the
+    //    reservation itself to commit (commit(n)
+    //    does nothing in this mode and returns 0)
+    //
+    // -- The commit functions return the number
+    //    of data points published
+    //
+    // -- reserve_no_wait works like reserve, but
+    //    instead of waiting for room (under the
+    //    BLOCK overrun policy) or for the writers
+    //    lock, it hands out an empty reservation
+
+    blWriteReservation<blDataType>                                          reserve(const std::size_t& numberOfElements);
+    blWriteReservation<blDataType>                                          reserve_no_wait(const std::size_t& numberOfElements);
+
+    std::size_t                                                             commit(const std::size_t& numberOfElements);
+    std::size_t                                                             commit(const blWriteReservation<blDataType>& reservation);
+
+
+
+protected: // Protected functions
+
+
+
+    // Functions used to get the (up to two)
+    // contiguous spans covering a specified
+    // number of data points starting at the
+    // specified write sequence
+
+    blSpanPair<blDataType>                                                  contiguousSpans(const std::uint64_t& sequence,
+                                                                                            const std::size_t& numberOfElements);
+
+    blSpanPair<const blDataType>                                            contiguousSpans(const std::uint64_t& sequence,
+                                                                                            const std::size_t& numberOfElements)const;
+
+
+
+    // Functions used by the locked writers
+    // mode to take turns writing, either
+    // waiting using the wait strategy or
+    // giving up right away
+
+    void                                                                    lockWriters();
+    bool                                                                    tryLockWriters();
+    void                                                                    unlockWriters();
+
+
+
+    // These functions do the actual copying
+    // of data into the buffer at the write
+    // iterator and then publish the new
+    // write sequence
+    //
+    // They do not synchronize with other
+    // writers, so the caller has to make
+    // sure it's the only thread writing
+
+    std::size_t                                                             write_unsynchronized(const char* buffer,
+                                                                                                 const std::size_t& bufferLength);
+
+    template<typename blInputIteratorType>
+    std::size_t                                                             write_unsynchronized(const blInputIteratorType& begin,
+                                                                                                 const blInputIteratorType& end);
+
+
+
+    // Functions used to publish the
+    // current position of the write
+    // iterator (or the specified write
+    // sequence) to the readers
+
+    void                                                                    publishWriteSequence();
+    void                                                                    publishWriteSequence(const std::uint64_t& writeSequence);
+
+
+
+    // Function used to point this buffer
+    // to a control block living somewhere
+    // else (or back to its own control
+    // block when passed a null pointer),
+    // which also moves the write iterator
+    // to the control block's published
+    // write sequence
+
+    void                                                                    setControlBlock(blRingControlBlock* controlBlock);
+
+
+
+    // Function used by a writer that just
+    // got its turn to move the write iterator
+    // to the published write sequence, in case
+    // a writer using another copy of the write
+    // iterator (for example in another process)
+    // wrote in the meantime
+
+    void                                                                    syncWriteIterator();
+
+
+
+    // Function used to wake up parked
+    // readers, but only once the published
+    // write sequence crosses the lowest
+    // watermark among them
+
+    void                                                                    notifyReaders();
+
+
+
+    // Functions used to apply the overrun
+    // policy
+    //
+    // -- minimumReaderCursor scans the reader
+    //    registry for the slowest reader's cursor
+    //    (the maximum value if there are no
+    //    readers)
+    //
+    // -- hasRoomFor checks whether the buffer
+    //    can be written up to the specified write
+    //    sequence without overwriting unread
+    //    data, using the cached minimum reader
+    //    cursor and rescanning the registry only
+    //    when the cached value says there's no room
+    //
+    // -- waitForRoom applies the overrun policy
+    //    to a write of the specified number of
+    //    data points at the published write
+    //    sequence, returning false if the write
+    //    has to be dropped
+    //
+    // -- notifyBlockedWriters is called by
+    //    readers after moving their cursors
+    //    forward
+
+    std::uint64_t                                                           minimumReaderCursor()const;
+
+    bool                                                                    hasRoomFor(const std::uint64_t& endSequence);
+
+    bool                                                                    waitForRoom(const std::size_t& numberOfElements,
+                                                                                        const bool& shouldWait);
+
+    void                                                                    notifyBlockedWriters();
+
+
+
+    // Functions used by the multiple
+    // writers mode to claim a range of
+    // the buffer and later commit it
+    //
+    // The claim function gets the sequence
+    // at which the claimed range starts and
+    // returns false if the overrun policy
+    // doesn't let it claim the range, it
+    // returns once the range claimed one
+    // buffer length before has been committed,
+    // while the commit function waits for all
+    // previously claimed ranges to be
+    // committed before publishing this one
+    //
+    // claimRangeThatFits claims a range
+    // under the BLOCK and FAIL policies
+
+    bool                                                                    claimWriteSequence(const std::size_t& numberOfElementsToClaim,
+                                                                                               std::uint64_t& claimedSequence,
+                                                                                               const bool& shouldWaitForRoom);
+
+    bool                                                                    claimRangeThatFits(const std::size_t& numberOfElementsToClaim,
+                                                                                               std::uint64_t& claimedSequence,
+                                                                                               const bool& shouldWaitForRoom);
+
+    void                                                                    commitWriteSequence(const std::uint64_t& claimedSequence,
+                                                                                                const std::size_t& numberOfClaimedElements);
+
+
+
+    // These functions write data using
+    // the claim/commit protocol of the
+    // multiple writers mode
+
+    std::size_t                                                             write_claim_commit(const char* buffer,
+                                                                                               const std::size_t& bufferLength,
+                                                                                               const bool& shouldWaitForRoom);
+
+    template<typename blInputIteratorType>
+    std::size_t                                                             write_claim_commit(const blInputIteratorType& begin,
+                                                                                               const blInputIteratorType& end,
+                                                                                               const bool& shouldWaitForRoom);
+
+
+
+    // Function used by reserve and
+    // reserve_no_wait to reserve a
+    // range of the buffer, waiting or
+    // not for room and for the writers
+    // lock
+
+    blWriteReservation<blDataType>                                          reserveRange(const std::size_t& numberOfElements,
+                                                                                         const bool& shouldWait);
+
+
+
+private: // Private functions
+
+
+
+    // Functions used by the copy and move
+    // operations to copy or take over the
+    // source's control block and writing spot
+
+    void                                                                    copyControlBlockFrom(const blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer7);
+    void                                                                    takeControlBlockFrom(blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer7);
+
+
+
 protected: // Protected variables
 
 
@@ -233,11 +741,29 @@ protected: // Protected variables
 
 
 
-    // Atomic boolean used to know whether
-    // the buffer is currently being written
-    // to by a thread
+    // The mode used to synchronize writers
+    // and the policy applied when writers
+    // catch up with the slowest reader
+
+    blWriteMode                                                             m_writeMode;
+
+    blOverrunPolicy                                                         m_overrunPolicy;
+
 
-    std::atomic_bool                                                        m_isBufferBeingCurrentlyWrittenTo;
+
+    // The state shared by the writers
+    // and readers of this buffer, which
+    // is either owned by this buffer or
+    // lives somewhere else (for example
+    // in shared memory)
+    //
+    // The owned control block is kept on
+    // the heap so that moving the buffer
+    // does not move the readers' cursors
+
+    std::unique_ptr<blRingControlBlock>                                     m_ownedControlBlock;
+
+    blRingControlBlock*                                                     m_controlBlock;
 };
 //-------------------------------------------------------------------
 
@@ -250,16 +776,29 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::blBuffer_7() : blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>()
+inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_7() : blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>()
 {
-    // We start by saying that this
-    // buffer is not currently being
-    // written to as it's just being
-    // constructed at this moment
+    // By default the buffer uses its
+    // own control block, which starts
+    // out with nothing written and not
+    // being written to
+
+    m_ownedControlBlock.reset(new blRingControlBlock());
+
+    m_controlBlock = m_ownedControlBlock.get();
+
+
 
-    m_isBufferBeingCurrentlyWrittenTo = false;
+    // By default any thread can write
+    // and the oldest data just gets
+    // overwritten
+
+    m_writeMode = blWriteMode::LOCKED_WRITERS;
+
+    m_overrunPolicy = blOverrunPolicy::OVERWRITE;
 
 
 
@@ -278,179 +817,1464 @@ inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDime
 
 
 //-------------------------------------------------------------------
-// Destructor
+// Copy constructor
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::~blBuffer_7()
+inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_7(const blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer7) : blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>(buffer7)
 {
+    copyControlBlockFrom(buffer7);
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// These function are used to manually
-// advance the write iterator
+// Move constructor
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::advance_writeIterator(const std::ptrdiff_t& movement)
+inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_7(blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer7) noexcept : blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>(std::move(buffer7))
 {
-    m_writeIterator.advance(movement);
+    takeControlBlockFrom(buffer7);
 }
+//-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::setPosition_writeIterator(const std::ptrdiff_t& positionInTheBuffer)
+inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::~blBuffer_7()
 {
-    m_writeIterator.setDataIndex(positionInTheBuffer);
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// Function used to get the write iterator
+// Assignment operator
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline const typename blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circular_iterator& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::writeIterator()const
+inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::operator=(const blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer7)
 {
-    return m_writeIterator;
+    if(this == &buffer7)
+        return (*this);
+
+    blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::operator=(buffer7);
+
+    copyControlBlockFrom(buffer7);
+
+    return (*this);
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// Function used to ask whether the buffer is
-// being currently written to
+// Move assignment operator
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline bool blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::isBufferBeingCurrentlyWrittenTo()const
+inline blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::operator=(blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer7) noexcept(blBuffer_0<blDataType,blMaxNumOfDimensions,blAllocator>::isMoveAssignmentNoexcept)
 {
-    return bool(m_isBufferBeingCurrentlyWrittenTo);
+    if(this == &buffer7)
+        return (*this);
+
+    blBuffer_6<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::operator=(std::move(buffer7));
+
+    takeControlBlockFrom(buffer7);
+
+    return (*this);
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// The following functions can be used to
-// write from a specified variable or buffer
-// into this buffer
-//
-// When using the "write_buffer" function, we
-// assume that the user specified buffer defines
-// the functions "data()" and "size()"
+// Function used by the copy operations to give
+// this buffer a control block of its own that
+// starts where the source's writers are
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-template<typename blValueType>
-
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_value(const blValueType& value)
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::copyControlBlockFrom(const blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer7)
 {
-    return ( this->write(reinterpret_cast<const char*>(&value),sizeof(value)) ) / sizeof(value);
-}
+    // A source pointing to a control block
+    // that lives somewhere else wraps data
+    // living there too, which our copy wraps
+    // as well, so we share the control block,
+    // otherwise we get a fresh one with the
+    // source's write sequence and wait
+    // strategies (the source's readers and
+    // their handles stay with the source)
+
+    m_ownedControlBlock.reset(new blRingControlBlock());
+
+    if(buffer7.m_controlBlock != buffer7.m_ownedControlBlock.get())
+        m_controlBlock = buffer7.m_controlBlock;
+    else
+    {
+        m_controlBlock = m_ownedControlBlock.get();
 
+        std::uint64_t publishedWriteSequence = buffer7.m_controlBlock->m_publishedWriteSequence.load(std::memory_order_acquire);
 
+        m_controlBlock->m_publishedWriteSequence.store(publishedWriteSequence,std::memory_order_relaxed);
+        m_controlBlock->m_claimedWriteSequence.store(publishedWriteSequence,std::memory_order_relaxed);
 
-template<typename blDataType,
-         typename blDataPtr,
-         typename blBufferPtr,
-         typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+        m_controlBlock->m_writersWaitStrategy = buffer7.m_controlBlock->m_writersWaitStrategy;
+        m_controlBlock->m_readersWaitStrategy = buffer7.m_controlBlock->m_readersWaitStrategy;
+    }
 
-template<typename blValueType>
+    m_writeMode = buffer7.m_writeMode;
+    m_overrunPolicy = buffer7.m_overrunPolicy;
 
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_value(const blValueType* value)
-{
-    if(value)
-        return ( this->write(reinterpret_cast<const char*>(value),sizeof(*value)) ) / sizeof(value);
-    else
-        return std::size_t(0);
+    m_writeIterator = circular_iterator(this,buffer7.m_writeIterator.getDataIndex(),-1);
 }
+//-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Function used by the move operations to take
+// over the source's control block and writing
+// spot, leaving the source with a fresh control
+// block of its own
+//-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-template<typename blBufferType>
-
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_buffer(const blBufferType& buffer)
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::takeControlBlockFrom(blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer7)
 {
-    return ( this->write(reinterpret_cast<const char*>(buffer.data()),sizeof(buffer.data()[0])*(buffer.size())) ) / sizeof(buffer.data()[0]);
-}
+    // The source either uses its own control
+    // block, which we now own (the readers'
+    // cursors and handles stay valid), or one
+    // that lives somewhere else, which we now
+    // point to as well
 
+    bool didSourceUseItsOwnControlBlock = (buffer7.m_controlBlock == buffer7.m_ownedControlBlock.get());
+
+    m_ownedControlBlock = std::move(buffer7.m_ownedControlBlock);
+
+    if(didSourceUseItsOwnControlBlock)
+        m_controlBlock = m_ownedControlBlock.get();
+    else
+        m_controlBlock = buffer7.m_controlBlock;
+
+    m_writeMode = buffer7.m_writeMode;
+    m_overrunPolicy = buffer7.m_overrunPolicy;
+
+
+
+    // Writing continues where the
+    // source left off, but the write
+    // iterator has to circulate around
+    // this buffer
+
+    m_writeIterator = circular_iterator(this,buffer7.m_writeIterator.getDataIndex(),-1);
+
+
+
+    // Finally the source starts
+    // over with a fresh control block
+
+    buffer7.m_ownedControlBlock.reset(new blRingControlBlock());
+
+    buffer7.setControlBlock(nullptr);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// These function are used to manually
+// advance the write iterator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::advance_writeIterator(const std::ptrdiff_t& movement)
+{
+    m_writeIterator.advance(movement);
+
+    publishWriteSequence();
+
+    m_controlBlock->m_claimedWriteSequence.store(m_controlBlock->m_publishedWriteSequence.load(std::memory_order_relaxed),std::memory_order_relaxed);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setPosition_writeIterator(const std::ptrdiff_t& positionInTheBuffer)
+{
+    m_writeIterator.setDataIndex(positionInTheBuffer);
+
+    publishWriteSequence();
+
+    m_controlBlock->m_claimedWriteSequence.store(m_controlBlock->m_publishedWriteSequence.load(std::memory_order_relaxed),std::memory_order_relaxed);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to get the write iterator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const typename blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circular_iterator& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::writeIterator()const
+{
+    return m_writeIterator;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to ask whether the buffer is
+// being currently written to
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline bool blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::isBufferBeingCurrentlyWrittenTo()const
+{
+    return m_controlBlock->m_isBufferBeingCurrentlyWrittenTo.load(std::memory_order_relaxed);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the write mode
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const blWriteMode& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::writeMode()const
+{
+    return m_writeMode;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setWriteMode(const blWriteMode& writeMode)
+{
+    m_writeMode = writeMode;
+
+
+
+    // Any claim made from now on
+    // starts where the last write
+    // was published
+
+    m_controlBlock->m_claimedWriteSequence.store(m_controlBlock->m_publishedWriteSequence.load(std::memory_order_relaxed),std::memory_order_relaxed);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the overrun policy
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const blOverrunPolicy& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::overrunPolicy()const
+{
+    return m_overrunPolicy;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setOverrunPolicy(const blOverrunPolicy& overrunPolicy)
+{
+    m_overrunPolicy = overrunPolicy;
+
+
+
+    // We force the next write
+    // to rescan the readers
+
+    m_controlBlock->m_cachedMinimumReaderCursor.store(0,std::memory_order_relaxed);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::uint64_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::numberOfFailedWrites()const
+{
+    return m_controlBlock->m_numberOfFailedWrites.load(std::memory_order_relaxed);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to apply the overrun policy
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::uint64_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::minimumReaderCursor()const
+{
+    std::uint64_t minimumCursor = std::numeric_limits<std::uint64_t>::max();
+
+    m_controlBlock->m_readers.forEachActiveReader([&minimumCursor](const blReaderSlot& readerSlot)
+    {
+        minimumCursor = std::min(minimumCursor,readerSlot.m_cursor.load(std::memory_order_acquire));
+    });
+
+    return minimumCursor;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline bool blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::hasRoomFor(const std::uint64_t& endSequence)
+{
+    // The write fits if it doesn't go
+    // a whole buffer past the slowest
+    // reader, and since readers only
+    // ever move forward, the cached
+    // cursor is usually good enough
+
+    if(endSequence <= this->size() ||
+       endSequence - this->size() <= m_controlBlock->m_cachedMinimumReaderCursor.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+
+
+    // Otherwise we rescan the readers
+
+    std::uint64_t minimumCursor = minimumReaderCursor();
+
+    m_controlBlock->m_cachedMinimumReaderCursor.store(minimumCursor,std::memory_order_relaxed);
+
+    return (endSequence - this->size() <= minimumCursor);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline bool blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::waitForRoom(const std::size_t& numberOfElements,
+                                                                                                                      const bool& shouldWait)
+{
+    if(m_overrunPolicy == blOverrunPolicy::OVERWRITE)
+        return true;
+
+
+
+    // The caller owns the write
+    // iterator, so the published
+    // sequence is where it writes
+
+    std::uint64_t endSequence = m_controlBlock->m_publishedWriteSequence.load(std::memory_order_relaxed) + static_cast<std::uint64_t>(numberOfElements);
+
+    if(numberOfElements <= this->size())
+    {
+        if(hasRoomFor(endSequence))
+            return true;
+
+        if(m_overrunPolicy == blOverrunPolicy::BLOCK && shouldWait)
+        {
+            m_controlBlock->m_writersWaitStrategy.wait([this,&endSequence]()
+            {
+                return hasRoomFor(endSequence);
+            });
+
+            return true;
+        }
+    }
+
+
+
+    // The write is dropped
+
+    m_controlBlock->m_numberOfFailedWrites.fetch_add(1,std::memory_order_relaxed);
+
+    return false;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::notifyBlockedWriters()
+{
+    if(m_overrunPolicy == blOverrunPolicy::BLOCK)
+        m_controlBlock->m_writersWaitStrategy.notify();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to publish/get the write sequence
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::uint64_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::publishedWriteSequence()const
+{
+    return m_controlBlock->m_publishedWriteSequence.load(std::memory_order_acquire);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::publishWriteSequence()
+{
+    // A plain store with release semantics,
+    // no read-modify-write needed since only
+    // the thread currently writing ever
+    // publishes the sequence
+
+    publishWriteSequence(static_cast<std::uint64_t>(m_writeIterator.getDataIndex()));
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::publishWriteSequence(const std::uint64_t& writeSequence)
+{
+    m_controlBlock->m_publishedWriteSequence.store(writeSequence,std::memory_order_release);
+
+    notifyReaders();
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::notifyReaders()
+{
+    // Readers that poll don't need
+    // to be woken up at all
+
+    if(m_controlBlock->m_readersWaitStrategy.type() != blWaitStrategyType::SPIN_YIELD_THEN_PARK)
+        return;
+
+
+
+    // A relaxed check is enough here,
+    // only the reader fences after
+    // lowering the watermark, and a
+    // reader whose watermark we miss
+    // wakes up by itself within
+    // "blWaitStrategy::maxParkTime"
+
+    if(m_controlBlock->m_publishedWriteSequence.load(std::memory_order_relaxed) < m_controlBlock->m_lowestReaderWatermark.load(std::memory_order_relaxed))
+        return;
+
+
+
+    // The lowest watermark has been
+    // crossed, so we clear it and wake
+    // the parked readers up, the ones
+    // still waiting for more data lower
+    // it again before parking
+
+    m_controlBlock->m_lowestReaderWatermark.store(std::numeric_limits<std::uint64_t>::max(),std::memory_order_relaxed);
+
+    m_controlBlock->m_readersWaitStrategy.notify();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to choose the control block and to
+// keep the write iterator in sync with it
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setControlBlock(blRingControlBlock* controlBlock)
+{
+    if(controlBlock != nullptr)
+        m_controlBlock = controlBlock;
+    else
+        m_controlBlock = m_ownedControlBlock.get();
+
+
+
+    // Writing continues wherever the
+    // writers of this control block
+    // left off
+
+    m_writeIterator = circular_iterator(this,
+                                        static_cast<std::ptrdiff_t>(m_controlBlock->m_publishedWriteSequence.load(std::memory_order_acquire)),
+                                        -1);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::syncWriteIterator()
+{
+    // The writer that published before us
+    // released the writers flag after
+    // publishing, so a relaxed load sees
+    // its sequence
+
+    std::uint64_t writeSequence = m_controlBlock->m_publishedWriteSequence.load(std::memory_order_relaxed);
+
+    if(static_cast<std::uint64_t>(m_writeIterator.getDataIndex()) != writeSequence)
+        m_writeIterator = circular_iterator(this,static_cast<std::ptrdiff_t>(writeSequence),-1);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following functions can be used to
+// write from a specified variable or buffer
+// into this buffer
+//
+// When using the "write_buffer" function, we
+// assume that the user specified buffer defines
+// the functions "data()" and "size()"
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blValueType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_value(const blValueType& value)
+{
+    return ( this->write(reinterpret_cast<const char*>(&value),sizeof(value)) ) / sizeof(value);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blValueType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_value(const blValueType* value)
+{
+    if(value)
+        return ( this->write(reinterpret_cast<const char*>(value),sizeof(*value)) ) / sizeof(value);
+    else
+        return std::size_t(0);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blBufferType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_buffer(const blBufferType& buffer)
+{
+    return ( this->write(reinterpret_cast<const char*>(buffer.data()),sizeof(buffer.data()[0])*(buffer.size())) ) / sizeof(buffer.data()[0]);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blBufferType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_buffer(const blBufferType* buffer,
+                                                                                                                              const std::size_t& bufferLength)
+{
+    return ( this->write(reinterpret_cast<const char*>(buffer),sizeof(buffer[0])*(bufferLength)) ) / sizeof(buffer[0]);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following functions are the
+// same as the above functions but
+// with the difference that they
+// DO NOT wait in case another thread
+// is currently writing to the buffer
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blValueType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_value_no_wait(const blValueType& value)
+{
+    return ( this->write_no_wait(reinterpret_cast<const char*>(&value),sizeof(value)) ) / sizeof(value);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blValueType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_value_no_wait(const blValueType* value)
+{
+    if(value)
+        return ( this->write_no_wait(reinterpret_cast<const char*>(value),sizeof(*value)) ) / sizeof(value);
+    else
+        return std::size_t(0);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blBufferType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_buffer_no_wait(const blBufferType& buffer)
+{
+    return ( this->write_no_wait(reinterpret_cast<const char*>(buffer.data()),sizeof(buffer.data()[0])*(buffer.size())) ) / sizeof(buffer.data()[0]);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blBufferType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_buffer_no_wait(const blBufferType* buffer,
+                                                                                                                                      const std::size_t& bufferLength)
+{
+    return ( this->write_no_wait(reinterpret_cast<const char*>(buffer),sizeof(buffer[0])*(bufferLength)) ) / sizeof(buffer[0]);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to choose/get the writers/readers wait strategies
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::setWaitStrategy(const blWaitStrategyType& waitStrategyType)
+{
+    m_controlBlock->m_writersWaitStrategy.setType(waitStrategyType);
+    m_controlBlock->m_readersWaitStrategy.setType(waitStrategyType);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blWaitStrategy& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::writersWaitStrategy()
+{
+    return m_controlBlock->m_writersWaitStrategy;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const blWaitStrategy& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::writersWaitStrategy()const
+{
+    return m_controlBlock->m_writersWaitStrategy;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blWaitStrategy& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::readersWaitStrategy()
+{
+    return m_controlBlock->m_readersWaitStrategy;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const blWaitStrategy& blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::readersWaitStrategy()const
+{
+    return m_controlBlock->m_readersWaitStrategy;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to reset the ring
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::resetRing()
+{
+    bool wasUsingItsOwnControlBlock = (m_controlBlock == m_ownedControlBlock.get());
+
+    m_ownedControlBlock.reset(new blRingControlBlock());
+
+    m_writeMode = blWriteMode::LOCKED_WRITERS;
+
+    m_overrunPolicy = blOverrunPolicy::OVERWRITE;
+
+    if(wasUsingItsOwnControlBlock)
+        setControlBlock(nullptr);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used by the locked writers mode to take turns
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::lockWriters()
+{
+    m_controlBlock->m_writersWaitStrategy.wait([this]()
+    {
+        return tryLockWriters();
+    });
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline bool blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::tryLockWriters()
+{
+    // We only attempt to grab the flag
+    // (test-and-set) once it looks free,
+    // so that waiting threads don't keep
+    // bouncing its cache line around
+
+    if(m_controlBlock->m_isBufferBeingCurrentlyWrittenTo.load(std::memory_order_relaxed) ||
+       m_controlBlock->m_isBufferBeingCurrentlyWrittenTo.exchange(true,std::memory_order_acquire))
+    {
+        return false;
+    }
+
+
+
+    // It's our turn, so we pick up
+    // where the last writer left off
+
+    syncWriteIterator();
+
+    return true;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::unlockWriters()
+{
+    m_controlBlock->m_isBufferBeingCurrentlyWrittenTo.store(false,std::memory_order_release);
+
+
+
+    // Another writer might be
+    // parked waiting for its turn
+
+    m_controlBlock->m_writersWaitStrategy.notify();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// This function does the actual writing to
+// the buffer, but waits in case another
+// thread is currently writing to this buffer
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write(const char* stuffToWrite,
+                                                                                                                       const std::size_t& numberOfBytesToWrite)
+{
+    // First we check to make
+    // sure we don't have a
+    // zero-sized buffer
+
+    if(this->size() == 0)
+    {
+        // We have a zero sized
+        // buffer, which means
+        // we can't write anything
+        // to it
+
+        return std::size_t(0);
+    }
+
+
+
+    // In single writer mode there's
+    // nobody to wait for, so we write
+    // straight away
+
+    if(m_writeMode == blWriteMode::SINGLE_WRITER)
+    {
+        if(!waitForRoom(numberOfBytesToWrite / sizeof(blDataType),true))
+            return std::size_t(0);
+
+        return write_unsynchronized(stuffToWrite,numberOfBytesToWrite);
+    }
+
+
+
+    // Multiple writers never wait
+    // for each other while copying
+
+    if(m_writeMode == blWriteMode::MULTIPLE_WRITERS)
+        return write_claim_commit(stuffToWrite,numberOfBytesToWrite,true);
+
+
+
+    // If another thread is currently
+    // writing to this buffer, this function
+    // waits around pantiently until it's
+    // clear to write
+
+    lockWriters();
+
+
+
+    // We now own the buffer, so we
+    // write and publish the data, as
+    // long as the overrun policy lets us
+
+    std::size_t numberOfBytesWritten = 0;
+
+    if(waitForRoom(numberOfBytesToWrite / sizeof(blDataType),true))
+        numberOfBytesWritten = write_unsynchronized(stuffToWrite,numberOfBytesToWrite);
+
+
+
+    // We're done writing, so we make
+    // sure everyone knows that
+
+    unlockWriters();
+
+
+
+    // We let the user know
+    // how many data elements
+    // were actually written
+    // to the buffer
+
+    return numberOfBytesWritten;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// This function does the actual writing to
+// the buffer, but quits if another thread
+// is currently writing to this buffer without
+// waiting
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_no_wait(const char* stuffToWrite,
+                                                                                                                               const std::size_t& numberOfBytesToWrite)
+{
+    // First we check to make
+    // sure we don't have a
+    // zero-sized buffer
+
+    if(this->size() == 0)
+    {
+        // We have a zero sized
+        // buffer, which means
+        // we can't write anything
+        // to it
+
+        return std::size_t(0);
+    }
+
+
+
+    // In single writer mode there's
+    // nobody to wait for, so we write
+    // straight away
+
+    if(m_writeMode == blWriteMode::SINGLE_WRITER)
+    {
+        if(!waitForRoom(numberOfBytesToWrite / sizeof(blDataType),false))
+            return std::size_t(0);
+
+        return write_unsynchronized(stuffToWrite,numberOfBytesToWrite);
+    }
+
+
+
+    // Multiple writers never wait
+    // for each other while copying
+
+    if(m_writeMode == blWriteMode::MULTIPLE_WRITERS)
+        return write_claim_commit(stuffToWrite,numberOfBytesToWrite,false);
+
+
+
+    // If another thread is currently
+    // writing to this buffer, this function
+    // quits without waiting
+
+    if(!tryLockWriters())
+    {
+        return std::size_t(0);
+    }
+
+
+
+    // We now own the buffer, so we
+    // write and publish the data, as
+    // long as the overrun policy lets us
+
+    std::size_t numberOfBytesWritten = 0;
+
+    if(waitForRoom(numberOfBytesToWrite / sizeof(blDataType),false))
+        numberOfBytesWritten = write_unsynchronized(stuffToWrite,numberOfBytesToWrite);
+
+
+
+    // We're done writing, so we make
+    // sure everyone knows that
+
+    unlockWriters();
+
+
+
+    // We let the user know
+    // how many data elements
+    // were actually written
+    // to the buffer
+
+    return numberOfBytesWritten;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// These functions doe the actual writing to
+// the buffer using iterators
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blInputIteratorType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write(const blInputIteratorType& begin,
+                                                                                                                       const blInputIteratorType& end)
+{
+    // In single writer mode there's
+    // nobody to wait for, so we write
+    // straight away
+
+    if(m_writeMode == blWriteMode::SINGLE_WRITER)
+    {
+        if(m_overrunPolicy != blOverrunPolicy::OVERWRITE &&
+           !waitForRoom(static_cast<std::size_t>(std::distance(begin,end)),true))
+        {
+            return std::size_t(0);
+        }
+
+        return write_unsynchronized(begin,end);
+    }
+
+
+
+    // Multiple writers never wait
+    // for each other while copying
+
+    if(m_writeMode == blWriteMode::MULTIPLE_WRITERS)
+        return write_claim_commit(begin,end,true);
+
+
+
+    // If another thread is currently
+    // writing to this buffer, this function
+    // waits around pantiently until it's
+    // clear to write
+
+    lockWriters();
+
+
+
+    // We now own the buffer, so we
+    // write and publish the data, as
+    // long as the overrun policy lets us
+
+    std::size_t numberOfDataPointsWritten = 0;
+
+    if(m_overrunPolicy == blOverrunPolicy::OVERWRITE ||
+       waitForRoom(static_cast<std::size_t>(std::distance(begin,end)),true))
+    {
+        numberOfDataPointsWritten = write_unsynchronized(begin,end);
+    }
+
+
+
+    // We're done writing, so we make
+    // sure everyone knows that
+
+    unlockWriters();
+
+
+
+    // We now return the amount
+    // of data points written to
+    // this buffer
+
+    return numberOfDataPointsWritten;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blInputIteratorType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_no_wait(const blInputIteratorType& begin,
+                                                                                                                               const blInputIteratorType& end)
+{
+    // In single writer mode there's
+    // nobody to wait for, so we write
+    // straight away
+
+    if(m_writeMode == blWriteMode::SINGLE_WRITER)
+    {
+        if(m_overrunPolicy != blOverrunPolicy::OVERWRITE &&
+           !waitForRoom(static_cast<std::size_t>(std::distance(begin,end)),false))
+        {
+            return std::size_t(0);
+        }
+
+        return write_unsynchronized(begin,end);
+    }
+
+
+
+    // Multiple writers never wait
+    // for each other while copying
+
+    if(m_writeMode == blWriteMode::MULTIPLE_WRITERS)
+        return write_claim_commit(begin,end,false);
+
+
+
+    // If another thread is currently
+    // writing to this buffer, this function
+    // quits without waiting
+
+    if(!tryLockWriters())
+    {
+        return std::size_t(0);
+    }
+
+
+
+    // We now own the buffer, so we
+    // write and publish the data, as
+    // long as the overrun policy lets us
+
+    std::size_t numberOfDataPointsWritten = 0;
+
+    if(m_overrunPolicy == blOverrunPolicy::OVERWRITE ||
+       waitForRoom(static_cast<std::size_t>(std::distance(begin,end)),false))
+    {
+        numberOfDataPointsWritten = write_unsynchronized(begin,end);
+    }
+
+
+
+    // We're done writing, so we make
+    // sure everyone knows that
+
+    unlockWriters();
+
+
+
+    // We now return the amount
+    // of data points written to
+    // this buffer
+
+    return numberOfDataPointsWritten;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// These functions do the actual copying of
+// data into the buffer and then publish the
+// new write sequence, without synchronizing
+// with other writers
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_unsynchronized(const char* stuffToWrite,
+                                                                                                                                      const std::size_t& numberOfBytesToWrite)
+{
+    std::size_t numberOfBytesWrittenSoFar = 0;
+    std::size_t numberOfBytesToWriteRightNow = 0;
+
+
+
+    while(numberOfBytesWrittenSoFar < numberOfBytesToWrite &&
+          !m_writeIterator.hasReachedEndOfBuffer())
+    {
+        // First we figure out how
+        // many data elements to write
+        // this current loop iteration
+        // depending on how many contiguous
+        // spots are available
+
+        numberOfBytesToWriteRightNow = std::min(numberOfBytesToWrite - numberOfBytesWrittenSoFar,
+                                                m_writeIterator.remainingContiguousBytes());
+
+
+
+        // Now we actually write the
+        // data to the buffer
+
+        std::copy(stuffToWrite + numberOfBytesWrittenSoFar,
+                  stuffToWrite + numberOfBytesWrittenSoFar + numberOfBytesToWriteRightNow,
+                  reinterpret_cast<char*>(&(*m_writeIterator)));
+
+
+
+        // We now advance the write iterator
+
+        m_writeIterator += numberOfBytesToWriteRightNow / sizeof(blDataType);
+
+
+
+        // We also keep track of the number
+        // of data elements written so far
+
+        numberOfBytesWrittenSoFar += numberOfBytesToWriteRightNow;
+    }
+
+
+
+    // The data is in the buffer, so
+    // we let the readers know about it
+
+    publishWriteSequence();
+
+
+
+    return numberOfBytesWrittenSoFar;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blInputIteratorType>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_unsynchronized(const blInputIteratorType& begin,
+                                                                                                                                      const blInputIteratorType& end)
+{
+    // We can't write anything
+    // to a zero sized buffer
+
+    if(this->size() == 0)
+        return std::size_t(0);
+
+
+
+    // We copy the data into this buffer,
+    // in a mirrored buffer the data fits
+    // in one contiguous span as long as
+    // it's not bigger than the buffer
+
+    auto numberOfDataPointsWritten = std::distance(begin,end);
+
+    if(this->isMirrored() && static_cast<std::size_t>(numberOfDataPointsWritten) <= this->size())
+        std::copy(begin,end,&(*m_writeIterator));
+    else
+        std::copy(begin,end,this->m_writeIterator);
+
+
+
+    // We advance the write iterator
+
+    m_writeIterator.advance(numberOfDataPointsWritten);
 
 
-template<typename blDataType,
-         typename blDataPtr,
-         typename blBufferPtr,
-         typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
 
-template<typename blBufferType>
+    // The data is in the buffer, so
+    // we let the readers know about it
 
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_buffer(const blBufferType* buffer,
-                                                                                                                  const std::size_t& bufferLength)
-{
-    return ( this->write(reinterpret_cast<const char*>(buffer),sizeof(buffer[0])*(bufferLength)) ) / sizeof(buffer[0]);
+    publishWriteSequence();
+
+
+
+    return static_cast<std::size_t>(numberOfDataPointsWritten);
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// The following functions are the
-// same as the above functions but
-// with the difference that they
-// DO NOT wait in case another thread
-// is currently writing to the buffer
+// Zero-copy reserve/commit write functions
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
-
-template<typename blValueType>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_value_no_wait(const blValueType& value)
+inline blWriteReservation<blDataType> blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::reserve(const std::size_t& numberOfElements)
 {
-    return ( this->write_no_wait(reinterpret_cast<const char*>(&value),sizeof(value)) ) / sizeof(value);
+    return reserveRange(numberOfElements,true);
 }
 
 
@@ -459,16 +2283,12 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
-
-template<typename blValueType>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_value_no_wait(const blValueType* value)
+inline blWriteReservation<blDataType> blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::reserve_no_wait(const std::size_t& numberOfElements)
 {
-    if(value)
-        return ( this->write_no_wait(reinterpret_cast<const char*>(value),sizeof(*value)) ) / sizeof(value);
-    else
-        return std::size_t(0);
+    return reserveRange(numberOfElements,false);
 }
 
 
@@ -477,311 +2297,487 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-template<typename blBufferType>
-
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_buffer_no_wait(const blBufferType& buffer)
+inline blWriteReservation<blDataType> blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::reserveRange(const std::size_t& numberOfElements,
+                                                                                                                                              const bool& shouldWait)
 {
-    return ( this->write_no_wait(reinterpret_cast<const char*>(buffer.data()),sizeof(buffer.data()[0])*(buffer.size())) ) / sizeof(buffer.data()[0]);
-}
+    blWriteReservation<blDataType> reservation;
 
 
 
-template<typename blDataType,
-         typename blDataPtr,
-         typename blBufferPtr,
-         typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+    // We can't reserve anything
+    // in a zero sized buffer
 
-template<typename blBufferType>
+    if(this->size() == 0)
+        return reservation;
 
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_buffer_no_wait(const blBufferType* buffer,
-                                                                                                                          const std::size_t& bufferLength)
-{
-    return ( this->write_no_wait(reinterpret_cast<const char*>(buffer),sizeof(buffer[0])*(bufferLength)) ) / sizeof(buffer[0]);
-}
-//-------------------------------------------------------------------
 
 
+    // We never hand out more
+    // than the whole buffer
 
-//-------------------------------------------------------------------
-// This function does the actual writing to
-// the buffer, but waits in case another
-// thread is currently writing to this buffer
-//-------------------------------------------------------------------
-template<typename blDataType,
-         typename blDataPtr,
-         typename blBufferPtr,
-         typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+    std::size_t numberOfElementsToReserve = std::min(numberOfElements,this->size());
 
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write(const char* stuffToWrite,
-                                                                                                           const std::size_t& numberOfBytesToWrite)
-{
-    // First we check to make
-    // sure we don't have a
-    // zero-sized buffer
+    if(numberOfElementsToReserve == 0)
+        return reservation;
 
-    if(this->size() == 0)
+
+
+    // Depending on the write mode,
+    // we either own the write iterator
+    // already, wait (or try) to own it,
+    // or claim our own range of the buffer
+
+    //
+    // If the overrun policy doesn't let
+    // us write, we hand out an empty
+    // reservation (having released the
+    // writers lock in the locked writers
+    // mode, so callers that skip empty
+    // reservations don't block the others)
+
+    switch(m_writeMode)
     {
-        // We have a zero sized
-        // buffer, which means
-        // we can't write anything
-        // to it
+        case blWriteMode::SINGLE_WRITER:
 
-        return std::size_t(0);
-    }
+            if(!waitForRoom(numberOfElementsToReserve,shouldWait))
+                return reservation;
 
+            reservation.m_sequence = static_cast<std::uint64_t>(m_writeIterator.getDataIndex());
+            break;
 
+        case blWriteMode::LOCKED_WRITERS:
 
-    // If another thread is currently
-    // writing to this buffer, this function
-    // waits around pantiently until it's
-    // clear to write
+            if(shouldWait)
+                lockWriters();
+            else if(!tryLockWriters())
+                return reservation;
 
-    while(m_isBufferBeingCurrentlyWrittenTo)
-    {
-        // We just wait until it's clear
-        // to write to this buffer
+            if(!waitForRoom(numberOfElementsToReserve,shouldWait))
+            {
+                unlockWriters();
+                return reservation;
+            }
+
+            reservation.m_sequence = static_cast<std::uint64_t>(m_writeIterator.getDataIndex());
+            break;
+
+        case blWriteMode::MULTIPLE_WRITERS:
+
+            if(!claimWriteSequence(numberOfElementsToReserve,reservation.m_sequence,shouldWait))
+                return reservation;
+
+            break;
     }
 
 
 
-    // We now let everyone know we're
-    // currently writing to this buffer
+    blSpanPair<blDataType> spans = contiguousSpans(reservation.m_sequence,numberOfElementsToReserve);
 
-    m_isBufferBeingCurrentlyWrittenTo = true;
+    reservation.m_first = spans.m_first;
+    reservation.m_second = spans.m_second;
 
 
 
-    std::size_t numberOfBytesWrittenSoFar = 0;
-    std::size_t numberOfBytesToWriteRightNow = 0;
+    return reservation;
+}
 
 
 
-    while(numberOfBytesWrittenSoFar < numberOfBytesToWrite &&
-          !m_writeIterator.hasReachedEndOfBuffer())
-    {
-        // First we figure out how
-        // many data elements to write
-        // this current loop iteration
-        // depending on how many contiguous
-        // spots are available
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-        numberOfBytesToWriteRightNow = std::min(numberOfBytesToWrite - numberOfBytesWrittenSoFar,
-                                                m_writeIterator.remainingContiguousBytes());
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::commit(const std::size_t& numberOfElements)
+{
+    // In the multiple writers mode we
+    // need to know where the reservation
+    // started, so the caller has to pass
+    // the reservation itself
 
+    if(this->size() == 0 || m_writeMode == blWriteMode::MULTIPLE_WRITERS)
+        return std::size_t(0);
 
 
-        // Now we actually write the
-        // data to the buffer
 
-        std::copy(stuffToWrite + numberOfBytesWrittenSoFar,
-                  stuffToWrite + numberOfBytesWrittenSoFar + numberOfBytesToWriteRightNow,
-                  reinterpret_cast<char*>(m_writeIterator.getPointerToIndexedDataPoint()));
+    // We own the write iterator, so we
+    // advance it past the written data
+    // and publish it
 
+    std::size_t numberOfElementsToCommit = std::min(numberOfElements,this->size());
 
+    m_writeIterator.advance(static_cast<std::ptrdiff_t>(numberOfElementsToCommit));
 
-        // We now advance the write iterator
+    publishWriteSequence();
 
-        m_writeIterator += numberOfBytesToWriteRightNow / sizeof(blDataType);
 
 
+    // In the locked writers mode
+    // we let the next writer go
 
-        // We also keep track of the number
-        // of data elements written so far
+    if(m_writeMode == blWriteMode::LOCKED_WRITERS)
+        unlockWriters();
 
-        numberOfBytesWrittenSoFar += numberOfBytesToWriteRightNow;
-    }
 
 
+    return numberOfElementsToCommit;
+}
 
-    // We're done writing, so we make
-    // sure everyone knows that
 
-    m_isBufferBeingCurrentlyWrittenTo = false;
 
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::commit(const blWriteReservation<blDataType>& reservation)
+{
+    // Empty reservations claimed
+    // nothing and hold no lock
+
+    if(this->size() == 0 || reservation.empty())
+        return std::size_t(0);
 
+    if(m_writeMode != blWriteMode::MULTIPLE_WRITERS)
+        return commit(reservation.size());
 
-    // We let the user know
-    // how many data elements
-    // were actually written
-    // to the buffer
 
-    return numberOfBytesWrittenSoFar;
+
+    commitWriteSequence(reservation.m_sequence,reservation.size());
+
+    return reservation.size();
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// This function does the actual writing to
-// the buffer, but quits if another thread
-// is currently writing to this buffer without
-// waiting
+// Functions used to get the contiguous spans covering
+// a number of data points starting at a write sequence
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_no_wait(const char* stuffToWrite,
-                                                                                                                   const std::size_t& numberOfBytesToWrite)
+inline blSpanPair<blDataType> blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::contiguousSpans(const std::uint64_t& sequence,
+                                                                                                                              const std::size_t& numberOfElements)
 {
-    // First we check to make
-    // sure we don't have a
-    // zero-sized buffer
+    blSpanPair<blDataType> spans;
 
     if(this->size() == 0)
-    {
-        // We have a zero sized
-        // buffer, which means
-        // we can't write anything
-        // to it
+        return spans;
 
-        return std::size_t(0);
+
+
+    // The first span goes from the
+    // sequence's spot in the buffer up
+    // to the end of the buffer at most,
+    // while the second span holds what
+    // wrapped around to the beginning
+    //
+    // In a mirrored buffer the data
+    // past the end of the buffer is the
+    // beginning of the buffer, so one
+    // span covers it all
+
+    std::size_t numberOfElementsToCover = std::min(numberOfElements,this->size());
+
+    std::size_t startingIndex = static_cast<std::size_t>(sequence % this->size());
+
+    if(this->isMirrored())
+    {
+        spans.m_first = blSpan<blDataType>(&(this->data()[startingIndex]),numberOfElementsToCover);
+        return spans;
     }
 
+    std::size_t numberOfElementsInFirstSpan = std::min(numberOfElementsToCover,this->size() - startingIndex);
 
+    spans.m_first = blSpan<blDataType>(&(this->data()[startingIndex]),numberOfElementsInFirstSpan);
 
-    // If another thread is currently
-    // writing to this buffer, this function
-    // quits without waiting
+    if(numberOfElementsToCover > numberOfElementsInFirstSpan)
+        spans.m_second = blSpan<blDataType>(&(this->data()[0]),numberOfElementsToCover - numberOfElementsInFirstSpan);
 
-    if(m_isBufferBeingCurrentlyWrittenTo)
-        return std::size_t(0);
+    return spans;
+}
 
 
 
-    // We now let everyone know we're
-    // currently writing to this buffer
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-    m_isBufferBeingCurrentlyWrittenTo = true;
+inline blSpanPair<const blDataType> blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::contiguousSpans(const std::uint64_t& sequence,
+                                                                                                                                    const std::size_t& numberOfElements)const
+{
+    blSpanPair<const blDataType> spans;
 
+    if(this->size() == 0)
+        return spans;
 
 
-    std::size_t numberOfBytesWrittenSoFar = 0;
-    std::size_t numberOfBytesToWriteRightNow = 0;
 
+    std::size_t numberOfElementsToCover = std::min(numberOfElements,this->size());
 
+    std::size_t startingIndex = static_cast<std::size_t>(sequence % this->size());
 
-    while(numberOfBytesWrittenSoFar < numberOfBytesToWrite &&
-          !m_writeIterator.hasReachedEndOfBuffer())
+    if(this->isMirrored())
     {
-        // First we figure out how
-        // many data elements to write
-        // this current loop iteration
-        // depending on how many contiguous
-        // spots are available
+        spans.m_first = blSpan<const blDataType>(&(this->data()[startingIndex]),numberOfElementsToCover);
+        return spans;
+    }
 
-        numberOfBytesToWriteRightNow = std::min(numberOfBytesToWrite - numberOfBytesWrittenSoFar,
-                                                m_writeIterator.remainingContiguousBytes());
+    std::size_t numberOfElementsInFirstSpan = std::min(numberOfElementsToCover,this->size() - startingIndex);
 
+    spans.m_first = blSpan<const blDataType>(&(this->data()[startingIndex]),numberOfElementsInFirstSpan);
 
+    if(numberOfElementsToCover > numberOfElementsInFirstSpan)
+        spans.m_second = blSpan<const blDataType>(&(this->data()[0]),numberOfElementsToCover - numberOfElementsInFirstSpan);
 
-        // Now we actually write the
-        // data to the buffer
+    return spans;
+}
+//-------------------------------------------------------------------
 
-        std::copy(stuffToWrite + numberOfBytesWrittenSoFar,
-                  stuffToWrite + numberOfBytesWrittenSoFar + numberOfBytesToWriteRightNow,
-                  reinterpret_cast<char*>(m_writeIterator.getPointerToIndexedDataPoint()));
 
 
+//-------------------------------------------------------------------
+// Functions used by the multiple writers
+// mode to claim and commit buffer ranges
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-        // We now advance the write iterator
+inline bool blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::claimWriteSequence(const std::size_t& numberOfElementsToClaim,
+                                                                                                                             std::uint64_t& claimedSequence,
+                                                                                                                             const bool& shouldWaitForRoom)
+{
+    // When overwriting, a single
+    // read-modify-write reserves a range
+    // no other writer can claim, otherwise
+    // we only claim the range once we know
+    // it fits, so we claim it with a
+    // compare-and-swap (so, just like with
+    // the locked writers, a range longer
+    // than the buffer is only ever written
+    // when overwriting)
+
+    if(m_overrunPolicy == blOverrunPolicy::OVERWRITE)
+    {
+        claimedSequence = m_controlBlock->m_claimedWriteSequence.fetch_add(static_cast<std::uint64_t>(numberOfElementsToClaim),
+                                                           std::memory_order_relaxed);
+    }
+    else if(!claimRangeThatFits(numberOfElementsToClaim,claimedSequence,shouldWaitForRoom))
+    {
+        return false;
+    }
 
-        m_writeIterator += numberOfBytesToWriteRightNow / sizeof(blDataType);
 
 
+    // Our range covers the slots of the
+    // range claimed one buffer length before
+    // it, so, like a disruptor gating on its
+    // wrap point, we wait for that range (and
+    // thus every range before it) to be
+    // committed before we copy anything
+    //
+    // A range longer than the buffer only
+    // copies its last buffer length of data,
+    // which waits for every earlier range
 
-        // We also keep track of the number
-        // of data elements written so far
+    std::uint64_t numberOfElementsToCopy = std::min(static_cast<std::uint64_t>(numberOfElementsToClaim),
+                                                    static_cast<std::uint64_t>(this->size()));
 
-        numberOfBytesWrittenSoFar += numberOfBytesToWriteRightNow;
+    auto isWrapPointCommitted = [this,&claimedSequence,&numberOfElementsToCopy]()
+    {
+        return m_controlBlock->m_publishedWriteSequence.load(std::memory_order_acquire) + this->size() >= claimedSequence + numberOfElementsToCopy;
+    };
+
+    if(!isWrapPointCommitted())
+        m_controlBlock->m_writersWaitStrategy.wait(isWrapPointCommitted);
+
+    return true;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline bool blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::claimRangeThatFits(const std::size_t& numberOfElementsToClaim,
+                                                                                                                             std::uint64_t& claimedSequence,
+                                                                                                                             const bool& shouldWaitForRoom)
+{
+    if(numberOfElementsToClaim > this->size())
+    {
+        m_controlBlock->m_numberOfFailedWrites.fetch_add(1,std::memory_order_relaxed);
+        return false;
     }
 
+    claimedSequence = m_controlBlock->m_claimedWriteSequence.load(std::memory_order_relaxed);
 
+    while(true)
+    {
+        if(!hasRoomFor(claimedSequence + numberOfElementsToClaim))
+        {
+            if(m_overrunPolicy == blOverrunPolicy::FAIL || !shouldWaitForRoom)
+            {
+                m_controlBlock->m_numberOfFailedWrites.fetch_add(1,std::memory_order_relaxed);
+                return false;
+            }
+
+            m_controlBlock->m_writersWaitStrategy.wait([this,&claimedSequence,&numberOfElementsToClaim]()
+            {
+                claimedSequence = m_controlBlock->m_claimedWriteSequence.load(std::memory_order_relaxed);
+
+                return hasRoomFor(claimedSequence + numberOfElementsToClaim);
+            });
+        }
+
+        if(m_controlBlock->m_claimedWriteSequence.compare_exchange_weak(claimedSequence,
+                                                        claimedSequence + numberOfElementsToClaim,
+                                                        std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+}
 
-    // We're done writing, so we make
-    // sure everyone knows that
 
-    m_isBufferBeingCurrentlyWrittenTo = false;
 
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
+inline void blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::commitWriteSequence(const std::uint64_t& claimedSequence,
+                                                                                                                         const std::size_t& numberOfClaimedElements)
+{
+    // Ranges are committed in the same
+    // order they were claimed, so we wait
+    // for every writer that claimed a range
+    // before ours to commit theirs first
 
-    // We let the user know
-    // how many data elements
-    // were actually written
-    // to the buffer
+    m_controlBlock->m_writersWaitStrategy.wait([this,&claimedSequence]()
+    {
+        return m_controlBlock->m_publishedWriteSequence.load(std::memory_order_acquire) == claimedSequence;
+    });
 
-    return numberOfBytesWrittenSoFar;
+
+
+    // It's our turn, so we're the only
+    // writer touching the write iterator
+    // right now, which we move past our
+    // range before publishing it
+
+    m_writeIterator.advance(static_cast<std::ptrdiff_t>(numberOfClaimedElements));
+
+    publishWriteSequence(claimedSequence + numberOfClaimedElements);
+
+
+
+    // The writer that claimed the range
+    // right after ours might be parked
+    // waiting for its turn
+
+    m_controlBlock->m_writersWaitStrategy.notify();
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// These functions doe the actual writing to
-// the buffer using iterators
+// These functions write data using the
+// claim/commit protocol of the multiple
+// writers mode
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-template<typename blInputIteratorType>
-
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write(const blInputIteratorType& begin,
-                                                                                                           const blInputIteratorType& end)
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_claim_commit(const char* stuffToWrite,
+                                                                                                                                    const std::size_t& numberOfBytesToWrite,
+                                                                                                                                    const bool& shouldWaitForRoom)
 {
-    // If another thread is currently
-    // writing to this buffer, this function
-    // waits around pantiently until it's
-    // clear to write
+    // Writers claim whole data points
 
-    while(m_isBufferBeingCurrentlyWrittenTo)
-    {
-        // We just wait until it's clear
-        // to write to this buffer
-    }
+    std::size_t numberOfElementsToWrite = numberOfBytesToWrite / sizeof(blDataType);
 
+    if(numberOfElementsToWrite == 0)
+        return std::size_t(0);
 
 
-    // We now let everyone know we're
-    // currently writing to this buffer
 
-    m_isBufferBeingCurrentlyWrittenTo = true;
+    // First we claim our range
 
+    std::uint64_t claimedSequence = 0;
 
+    if(!claimWriteSequence(numberOfElementsToWrite,claimedSequence,shouldWaitForRoom))
+        return std::size_t(0);
 
-    // Finally we copy the data
-    // into this buffer
 
-    std::copy(begin,end,this->m_writeIterator);
 
+    // If we're writing more than the
+    // whole buffer, only the last buffer
+    // length worth of data would survive
+    // anyway, so that's all we copy
 
+    std::size_t numberOfElementsToCopy = std::min(numberOfElementsToWrite,this->size());
+    std::size_t numberOfElementsToSkip = numberOfElementsToWrite - numberOfElementsToCopy;
 
-    // We advance the write iterator
+    const char* dataToCopy = stuffToWrite + numberOfElementsToSkip * sizeof(blDataType);
 
-    m_writeIterator += std::distance(begin,end);
 
 
+    // We copy the data in at most two
+    // contiguous chunks, the tail end of
+    // the buffer and then its beginning
 
-    // We're done writing, so we make
-    // sure everyone knows that
+    std::size_t startingIndex = static_cast<std::size_t>((claimedSequence + numberOfElementsToSkip) % this->size());
 
-    m_isBufferBeingCurrentlyWrittenTo = false;
+    std::size_t numberOfElementsInFirstChunk = std::min(numberOfElementsToCopy,this->size() - startingIndex);
 
+    std::copy(dataToCopy,
+              dataToCopy + numberOfElementsInFirstChunk * sizeof(blDataType),
+              reinterpret_cast<char*>(&(this->data()[startingIndex])));
 
+    std::copy(dataToCopy + numberOfElementsInFirstChunk * sizeof(blDataType),
+              dataToCopy + numberOfElementsToCopy * sizeof(blDataType),
+              reinterpret_cast<char*>(&(this->data()[0])));
 
-    // We now return the amount
-    // of data points written to
-    // this buffer
 
-    return std::distance(begin,end);
+
+    // Finally we commit our range
+
+    commitWriteSequence(claimedSequence,numberOfElementsToWrite);
+
+
+
+    return numberOfElementsToWrite * sizeof(blDataType);
 }
 
 
@@ -790,54 +2786,50 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
 template<typename blInputIteratorType>
 
-inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::write_no_wait(const blInputIteratorType& begin,
-                                                                                                                   const blInputIteratorType& end)
+inline std::size_t blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::write_claim_commit(const blInputIteratorType& begin,
+                                                                                                                                    const blInputIteratorType& end,
+                                                                                                                                    const bool& shouldWaitForRoom)
 {
-    // If another thread is currently
-    // writing to this buffer, this function
-    // quits without waiting
+    auto numberOfDataPointsToWrite = std::distance(begin,end);
 
-    if(m_isBufferBeingCurrentlyWrittenTo)
+    if(numberOfDataPointsToWrite <= 0 || this->size() == 0)
         return std::size_t(0);
 
 
 
-    // We now let everyone know we're
-    // currently writing to this buffer
-
-    m_isBufferBeingCurrentlyWrittenTo = true;
-
-
+    // First we claim our range
 
-    // Finally we copy the data
-    // into this buffer
+    std::uint64_t claimedSequence = 0;
 
-    std::copy(begin,end,this->m_writeIterator);
+    if(!claimWriteSequence(static_cast<std::size_t>(numberOfDataPointsToWrite),claimedSequence,shouldWaitForRoom))
+        return std::size_t(0);
 
 
 
-    // We advance the write iterator
+    // We copy the data using a circular
+    // iterator that starts at the beginning
+    // of our claimed range
 
-    m_writeIterator += std::distance(begin,end);
+    circular_iterator claimedRangeIterator(this,
+                                           static_cast<int>(claimedSequence % this->size()),
+                                           -1);
 
+    std::copy(begin,end,claimedRangeIterator);
 
 
-    // We're done writing, so we make
-    // sure everyone knows that
 
-    m_isBufferBeingCurrentlyWrittenTo = false;
+    // Finally we commit our range
 
+    commitWriteSequence(claimedSequence,static_cast<std::size_t>(numberOfDataPointsToWrite));
 
 
-    // We now return the amount
-    // of data points written to
-    // this buffer
 
-    return std::distance(begin,end);
+    return static_cast<std::size_t>(numberOfDataPointsToWrite);
 }
 //-------------------------------------------------------------------
 
@@ -8,40 +8,74 @@
 // BASE CLASS:      blBuffer_7
 //
 // PURPOSE:         -- This class is based on blBuffer_7 and adds
-//                     multiple "read" iterators to the buffer, where
-//                     each "read" iterator can be used by a separate
-//                     thread that wants to read from this buffer
+//                     multiple "readers" to the buffer, where each
+//                     reader can be used by a separate thread that
+//                     wants to read from this buffer
 //
 //                     -- This allows multiple threads to read from
 //                        this buffer simultaneously
 //
-//                     -- The different "read" iterators are accessed
-//                        by using the appropriate "read(id)" function
+//                     -- Each reader is a read cursor (the sequence of
+//                        the next data point to read) kept in its own
+//                        cache-line-padded slot of a fixed capacity,
+//                        lock-free registry (see blReaderRegistry.hpp)
+//
+//                     -- A thread registers its reader once using the
+//                        "registerReader(id)" function and gets back a
+//                        handle, which it then passes to the "read"
+//                        functions for O(1) access to its cursor, and
+//                        it deregisters the reader when it's done, so
+//                        that its slot can be reused
+//
+//                     -- The read functions can also be called with the
+//                        reader id instead of the handle, in which case
+//                        the reader is looked up in (or registered with)
+//                        the registry on every call
 //
 //                        -- For example if a thread uses the function
-//                           read(0), then it makes use of the readIterator0,
+//                           read(0), then it makes use of reader 0,
 //                           or if another thread uses the function
-//                           read(13), then it makes use of the readIterator13,
-//                           or read(-5) uses readIterator-5 and so on
+//                           read(13), then it makes use of reader 13,
+//                           or read(-5) uses reader -5 and so on
 //
-//                       -- All read iterators are stored in an unordered_map
-//                          and are created the instant a thread uses
-//                          the corresponding read(id) function for the
-//                          first time
-//
-//                       -- Each read iterator is advanced every time
-//                          the read(id) function is called by a thread
+//                       -- Each read cursor is advanced every time
+//                          the read function is called by a thread
 //                          and is advanced by the actual number of
 //                          elements read by that function
 //
-//                       -- Each read iterator cannot go past the current
-//                          write iterator of this buffer, so the reading
-//                          stops as soon as the read iterator reaches
-//                          the write iterator
+//                       -- Each read cursor cannot go past the current
+//                          published write sequence of this buffer, so the
+//                          reading stops as soon as the read cursor reaches
+//                          the last fully written data point
+//
+//                       -- The published write sequence is loaded with
+//                          acquire semantics, so everything before it
+//                          is guaranteed to be visible to the reader
+//
+//                       -- The read functions copy straight from the buffer's
+//                          memory in at most two contiguous chunks, using
+//                          memcpy when the data is trivially copyable and
+//                          the output is contiguous memory of the same type
+//
+//                       -- The "peek" and "release" functions let a reader
+//                          look at the unread data in place, without copying
+//                          it, and then advance its read cursor
+//
+//                       -- The "read_wait" functions let a reader wait (spin,
+//                          yield or park, based on the readers wait strategy)
+//                          until a minimum amount of data is available or a
+//                          timeout expires, and the writer only wakes parked
+//                          readers up once it crosses the lowest of their
+//                          watermarks
+//
+//                       -- Each reader keeps track of how much data it lost
+//                          and how many times it was lapped by the writer,
+//                          and of how far behind the writer it is, which
+//                          can be read lock-free using "readerStatistics"
 //
 //                       -- NOTE: Each thread is responsible of using a different
-//                                read<id> function to not cause multiple
-//                                threads fighting each other
+//                                reader to not cause multiple threads fighting
+//                                each other
 //
 //                  -- This class is defined within the blBufferLIB
 //                     namespace
@@ -65,9 +99,26 @@
 
 
 
-// Used to store read iterators
+// Used to store the read cursors
+
+#include "blReaderRegistry.hpp"
+
+
+
+// Used to copy and compare
+
+#include <algorithm>
+#include <utility>
+#include <cstring>
+#include <memory>
+#include <iterator>
+#include <type_traits>
+
+
+
+// Used to time out waiting readers
 
-#include <unordered_map>
+#include <chrono>
 
 //-------------------------------------------------------------------
 
@@ -82,6 +133,43 @@ namespace blBufferLIB
 
 
 
+//-------------------------------------------------------------------
+// Helper trait used to detect output iterators
+// that point to contiguous writable memory holding
+// data points of a specified type (raw pointers
+// and std::vector iterators)
+//-------------------------------------------------------------------
+template<typename blOutputIteratorType,
+         typename blDataType,
+         typename = void>
+
+struct blIsContiguousOutputIterator : std::false_type
+{
+};
+
+
+
+template<typename blOutputIteratorType,
+         typename blDataType>
+
+struct blIsContiguousOutputIterator<blOutputIteratorType,
+                                    blDataType,
+                                    std::void_t<typename std::iterator_traits<blOutputIteratorType>::value_type>>
+{
+    using value_type = typename std::iterator_traits<blOutputIteratorType>::value_type;
+    using reference = typename std::iterator_traits<blOutputIteratorType>::reference;
+
+    static constexpr bool value = std::is_same<value_type,blDataType>::value &&
+                                  !std::is_same<value_type,bool>::value &&
+                                  std::is_reference<reference>::value &&
+                                  !std::is_const<typename std::remove_reference<reference>::type>::value &&
+                                  (std::is_pointer<blOutputIteratorType>::value ||
+                                   std::is_same<blOutputIteratorType,typename std::vector<value_type>::iterator>::value);
+};
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // class blBuffer_8 declaration
 //-------------------------------------------------------------------
@@ -89,18 +177,19 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-class blBuffer_8 : public blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>
+class blBuffer_8 : public blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>
 {
 public: // Public type aliases
 
 
 
-    using circular_iterator = typename blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circular_iterator;
-    using circular_const_iterator = typename blBuffer_7<blDataType,const blDataPtr,const blBufferPtr,const blBufferRoiPtr,blMaxNumOfDimensions>::circular_const_iterator;
+    using circular_iterator = typename blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circular_iterator;
+    using circular_const_iterator = typename blBuffer_7<blDataType,const blDataPtr,const blBufferPtr,const blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circular_const_iterator;
 
-    using read_iterators_container = std::unordered_map<int,circular_iterator>;
+    using reader_registry = typename blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::reader_registry;
 
 
 
@@ -116,7 +205,13 @@ public: // Constructors and destructors
 
     // Copy constructor
 
-    blBuffer_8(const blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>& buffer8) = default;
+    blBuffer_8(const blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer8) = default;
+
+
+
+    // Move constructor
+
+    blBuffer_8(blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer8) noexcept = default;
 
 
 
@@ -132,7 +227,13 @@ public: // Overloaded operators
 
     // Assignment operator
 
-    blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>&   operator=(const blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>& buffer8) = default;
+    blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&   operator=(const blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>& buffer8) = default;
+
+
+
+    // Move assignment operator
+
+    blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&   operator=(blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>&& buffer8) = default;
 
 
 
@@ -140,36 +241,96 @@ public: // Public functions
 
 
 
-    // This function returns a reference
-    // to the read(id) iterator.
-    // If that read iterator does not
-    // exist yet, this function creates
-    // and initializes it to start at
-    // the beginning of the buffer
+    // Functions used to register/deregister
+    // a reader
+    //
+    // -- registerReader returns the handle
+    //    of the active reader with the specified
+    //    id, registering it if it doesn't exist
+    //    yet, in which case its cursor starts
+    //    at the oldest data still in the buffer
+    //
+    // -- The returned handle is invalid if
+    //    there's no room left for new readers
+    //
+    // -- deregisterReader frees the reader's
+    //    slot for other readers and returns
+    //    false if there was no such reader
+    //
+    // -- Every function taking a reader's id
+    //    looks the reader up in the registry
+    //    first, readers on a hot path should
+    //    keep the handle returned here and use
+    //    the overloads taking a handle instead
+
+    blReaderHandle                                                          registerReader(const int& id);
+
+    bool                                                                    deregisterReader(const blReaderHandle& handle);
+    bool                                                                    deregisterReader(const int& id);
+
+
+
+    // Function used to get a hold
+    // of the reader registry
+
+    const reader_registry&                                                  readers()const;
+
+
+
+    // These functions return a circular
+    // iterator pointing to a reader's
+    // current read position
+    //
+    // NOTE: The returned iterator is a copy,
+    //       moving it does not move the reader,
+    //       use the "release" function for that
 
-    circular_iterator&                                                      readIterator(const int& id);
+    circular_iterator                                                       readIterator(const blReaderHandle& handle);
+    circular_iterator                                                       readIterator(const int& id);
 
 
 
-    // This function reads data from
+    // These functions read data from
     // this buffer into an output
     // buffer
+    //
+    // -- They never wait for room in the
+    //    output buffer, if its overrun policy
+    //    doesn't let them write everything,
+    //    only what it took is read and the
+    //    rest is left for the next read
 
     template<typename blAnotherDataType,
              typename blAnotherDataPtr,
              typename blAnotherBufferPtr,
              typename blAnotherBufferRoiPtr,
-             std::size_t blDifferentMaxNumOfDimensions>
+             std::size_t blDifferentMaxNumOfDimensions,
+             typename blAnotherAllocator>
+
+    std::size_t                                                             read(const blReaderHandle& handle,
+                                                                                 blBuffer_8<blAnotherDataType,blAnotherDataPtr,blAnotherBufferPtr,blAnotherBufferRoiPtr,blDifferentMaxNumOfDimensions,blAnotherAllocator>& outputBuffer);
+
+    template<typename blAnotherDataType,
+             typename blAnotherDataPtr,
+             typename blAnotherBufferPtr,
+             typename blAnotherBufferRoiPtr,
+             std::size_t blDifferentMaxNumOfDimensions,
+             typename blAnotherAllocator>
 
     std::size_t                                                             read(const int& id,
-                                                                                 blBuffer_8<blAnotherDataType,blAnotherDataPtr,blAnotherBufferPtr,blAnotherBufferRoiPtr,blDifferentMaxNumOfDimensions>& outputBuffer);
+                                                                                 blBuffer_8<blAnotherDataType,blAnotherDataPtr,blAnotherBufferPtr,blAnotherBufferRoiPtr,blDifferentMaxNumOfDimensions,blAnotherAllocator>& outputBuffer);
 
 
 
-    // This function reads data from
+    // These functions read data from
     // this buffer into an output
     // buffer given by output iterators
 
+    template<typename blOutputIteratorType>
+    std::size_t                                                             read(const blReaderHandle& handle,
+                                                                                 const blOutputIteratorType& begin,
+                                                                                 const blOutputIteratorType& end);
+
     template<typename blOutputIteratorType>
     std::size_t                                                             read(const int& id,
                                                                                  const blOutputIteratorType& begin,
@@ -177,11 +338,13 @@ public: // Public functions
 
 
 
-    // This function reads unformattedreadIteratorsContainerType
+    // These functions read unformatted
     // raw data from this buffer and
-    // copies it into the specified buffer
-    // The specified "id" invokes the
-    // corresponding read(id) iterator
+    // copy it into the specified buffer
+
+    std::size_t                                                             read(const blReaderHandle& handle,
+                                                                                 char* outputBuffer,
+                                                                                 const std::size_t& outputBufferLength);
 
     std::size_t                                                             read(const int& id,
                                                                                  char* outputBuffer,
@@ -189,26 +352,172 @@ public: // Public functions
 
 
 
+    // These functions wait until at least
+    // the specified number of data points
+    // is available to the reader (or until
+    // the timeout expires) and then read
+    // into the output iterators just like
+    // the "read" functions do
+    //
+    // -- The minimum number of data points
+    //    is capped at the size of the buffer
+    //
+    // -- They return the number of data
+    //    points read, which is less than
+    //    the requested minimum only if the
+    //    wait timed out
+    //
+    // -- How readers wait is chosen by the
+    //    readers wait strategy, and parked
+    //    readers are only woken up once the
+    //    writer publishes past the lowest
+    //    of their watermarks, not on every
+    //    write
+
+    template<typename blOutputIteratorType>
+    std::size_t                                                             read_wait(const blReaderHandle& handle,
+                                                                                      const blOutputIteratorType& begin,
+                                                                                      const blOutputIteratorType& end,
+                                                                                      const std::size_t& minimumNumberOfElements,
+                                                                                      const std::chrono::nanoseconds& timeout);
+
+    template<typename blOutputIteratorType>
+    std::size_t                                                             read_wait(const int& id,
+                                                                                      const blOutputIteratorType& begin,
+                                                                                      const blOutputIteratorType& end,
+                                                                                      const std::size_t& minimumNumberOfElements,
+                                                                                      const std::chrono::nanoseconds& timeout);
+
+
+
+    // Zero-copy read functions
+    //
+    // -- peek returns up to two spans
+    //    covering all the data published
+    //    but not yet read by the reader,
+    //    without advancing its cursor
+    //
+    // -- release then advances the reader's
+    //    cursor by n data points (never past
+    //    the published write sequence) and
+    //    returns the number of data points
+    //    it was advanced by
+    //
+    // -- NOTE: The writer keeps writing
+    //          while the reader looks at the
+    //          peeked data, so a reader that
+    //          falls a whole buffer behind
+    //          will see it being overwritten
+
+    blSpanPair<const blDataType>                                            peek(const blReaderHandle& handle);
+    blSpanPair<const blDataType>                                            peek(const int& id);
+
+    std::size_t                                                             release(const blReaderHandle& handle,
+                                                                                    const std::size_t& numberOfElements);
+    std::size_t                                                             release(const int& id,
+                                                                                    const std::size_t& numberOfElements);
+
+
+
     // This function takes a specified
     // read iterator and advances it in
     // case that it has been lapped by
     // the current write iterator, so that
     // it won't mistakingly read the same
     // data over and over
+    //
+    // It returns the number of data
+    // points the iterator skipped
+
+    std::size_t                                                             adjustReadIterator(circular_iterator& readIter);
+
+
+
+    // These functions return the number
+    // of data points that have been
+    // published by the writer but not
+    // yet read by the specified read
+    // iterator or reader
+
+    std::size_t                                                             numberOfElementsAvailableToRead(const circular_iterator& readIter)const;
+    std::size_t                                                             numberOfElementsAvailableToRead(const blReaderHandle& handle)const;
+
+
+
+    // These functions return a snapshot
+    // of a reader's statistics, that is
+    // how much data it lost and how many
+    // times it was lapped by the writer,
+    // and how far behind the writer it
+    // is and has ever been
+    //
+    // They never block the reader, so
+    // they can be called at any time
+    // from a monitoring thread, and they
+    // return all zeros if there's no
+    // such reader
+
+    blReaderStatistics                                                      readerStatistics(const blReaderHandle& handle)const;
+    blReaderStatistics                                                      readerStatistics(const int& id)const;
+
+
+
+protected: // Protected functions
 
-    void                                                                    adjustReadIterator(circular_iterator& readIter);
 
 
+    // Function used to move a reader's
+    // cursor forward in case it has been
+    // lapped by the writer, returning the
+    // (possibly adjusted) cursor
 
-private: // Private variables
+    std::uint64_t                                                           adjustReaderCursor(blReaderSlot& readerSlot);
 
 
 
-    // Write iterator used to keep
-    // track of the current writing
-    // spot
+    // Function used to move a reader's
+    // cursor forward after reading, which
+    // also lets a writer blocked by this
+    // reader know there might be room now
 
-    read_iterators_container                                                m_readIterators;
+    void                                                                    advanceReaderCursor(blReaderSlot& readerSlot,
+                                                                                                const std::uint64_t& cursor);
+
+
+
+    // Function used to get the number
+    // of data points published but not
+    // yet read starting from a cursor
+
+    std::size_t                                                             numberOfElementsAvailableFromCursor(const std::uint64_t& cursor)const;
+
+
+
+    // Function used by a waiting reader
+    // to lower the buffer's lowest reader
+    // watermark down to its own one
+
+    void                                                                    lowerReaderWatermark(const std::uint64_t& watermark);
+
+
+
+    // Functions used to copy data from a
+    // pair of source spans into a pair of
+    // destination spans (or a single one)
+    // using memcpy whenever possible
+    //
+    // They return the number of data
+    // points copied
+
+    template<typename blSourceDataType,
+             typename blDestinationDataType>
+    static std::size_t                                                      copySpans(const blSpanPair<blSourceDataType>& source,
+                                                                                      const blSpanPair<blDestinationDataType>& destination);
+
+    template<typename blSourceDataType,
+             typename blDestinationDataType>
+    static std::size_t                                                      copySpans(const blSpanPair<blSourceDataType>& source,
+                                                                                      const blSpan<blDestinationDataType>& destination);
 };
 //-------------------------------------------------------------------
 
@@ -221,9 +530,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::blBuffer_8() : blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>()
+inline blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::blBuffer_8() : blBuffer_7<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>()
 {
 }
 //-------------------------------------------------------------------
@@ -237,9 +547,10 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::~blBuffer_8()
+inline blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::~blBuffer_8()
 {
 }
 //-------------------------------------------------------------------
@@ -247,78 +558,149 @@ inline blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDime
 
 
 //-------------------------------------------------------------------
-// The buffer calls this private function because a thread
-// calls the read(id) function which works with the read(id)
-// iterator.
-// If that iterator does not exist yet, this function creates
-// and initializes the iterator to point at the beginning of
-// the buffer
+// Functions used to register/deregister a reader
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline typename blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::circular_iterator& blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::readIterator(const int& id)
+inline blReaderHandle blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::registerReader(const int& id)
 {
-    // First we have to check if
-    // the specified read(id) iterator
-    // exists
+    // A new reader starts at the
+    // oldest data point still in
+    // the buffer, that is one buffer
+    // length behind the writer, or at
+    // the very beginning if the writer
+    // hasn't filled the buffer yet
+
+    blReaderHandle handle = this->m_controlBlock->m_readers.findReader(id);
+
+    if(handle.isValid())
+        return handle;
+
+    std::uint64_t writeSequence = this->publishedWriteSequence();
 
-    auto iter = m_readIterators.find(id);
+    std::uint64_t startingCursor = (writeSequence > this->size()) ? (writeSequence - this->size()) : std::uint64_t(0);
 
+    handle = this->m_controlBlock->m_readers.registerReader(id,startingCursor);
 
 
-    // If the requested read iterator
-    // exists, we're done and we
-    // return it
 
-    if(iter != m_readIterators.end())
-        return (iter->second);
+    // The writers' cached cursor of the
+    // slowest reader must not be ahead
+    // of the new reader
 
+    std::uint64_t cachedCursor = this->m_controlBlock->m_cachedMinimumReaderCursor.load(std::memory_order_relaxed);
 
+    while(handle.isValid() &&
+          startingCursor < cachedCursor &&
+          !this->m_controlBlock->m_cachedMinimumReaderCursor.compare_exchange_weak(cachedCursor,
+                                                                  startingCursor,
+                                                                  std::memory_order_relaxed))
+    {
+    }
+
+
+
+    return handle;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline bool blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::deregisterReader(const blReaderHandle& handle)
+{
+    // A writer might have been
+    // blocked by this reader
+
+    bool wasDeregistered = this->m_controlBlock->m_readers.deregisterReader(handle);
 
-    // If we made it here, that means the
-    // iterator does not exist yet, so we
-    // create it and initialize it
+    this->notifyBlockedWriters();
 
-    // NOTE:  The newly created read iterator
-    //        is defaulted to never stop, meaning
-    //        indefinite number of maximum circulations
-    //        This is because we only want the
-    //        read iterator to stop once it reaches
-    //        the current write iterator
+    return wasDeregistered;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline bool blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::deregisterReader(const int& id)
+{
+    return deregisterReader(this->m_controlBlock->m_readers.findReader(id));
+}
+//-------------------------------------------------------------------
 
-    circular_iterator newReadIterator((*this),0,-1);
 
 
+//-------------------------------------------------------------------
+// Function used to get a hold of the reader registry
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline const typename blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::reader_registry& blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::readers()const
+{
+    return this->m_controlBlock->m_readers;
+}
+//-------------------------------------------------------------------
 
-    // Let's adjust the newly created
-    // read iterator in case the current
-    // write iterator has lapped the buffer
-    // multiple times over
 
-    adjustReadIterator(newReadIterator);
 
+//-------------------------------------------------------------------
+// These functions return a circular iterator
+// pointing to a reader's current read position
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
+inline typename blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circular_iterator blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::readIterator(const blReaderHandle& handle)
+{
+    // NOTE:  The read iterator is defaulted
+    //        to never stop, meaning indefinite
+    //        number of maximum circulations
 
-    // Here we insert the newly created
-    // read(id) iterator into the unorderd_map
+    blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
 
-    m_readIterators.insert( {id,newReadIterator} );
+    if(readerSlot == nullptr)
+        return circular_iterator(this,0,-1);
 
+    return circular_iterator(this,static_cast<std::ptrdiff_t>(adjustReaderCursor(*readerSlot)),-1);
+}
 
 
-    // We just inserted the newly created
-    // and initialized read iterator into
-    // the unordered_map, so now we grab
-    // a hold of it and return it as a
-    // reference
 
-    iter = m_readIterators.find(id);
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-    return iter->second;
+inline typename blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::circular_iterator blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::readIterator(const int& id)
+{
+    return readIterator(registerReader(id));
 }
 //-------------------------------------------------------------------
 
@@ -336,274 +718,920 @@ template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline void blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::adjustReadIterator(circular_iterator& readIter)
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::adjustReadIterator(circular_iterator& readIter)
 {
-    // We compare the current number
-    // of circulations of the write
-    // iterator with the specified
-    // read iterator
-
-    if(this->m_writeIterator.getCurrentNumberOfCirculations() > readIter.getCurrentNumberOfCirculations())
-    {
-        // This means that the current write
-        // terator has lapped the specified
-        // read iterator, maybe even multiple
-        // times over
+    // We compare how far behind the
+    // published write sequence the
+    // specified read iterator is
 
-        // We advance the read iterator so
-        // that its current number of circulations
-        // is 1 less than the write iterator
+    auto distanceFromWriteSequence = static_cast<std::ptrdiff_t>(this->publishedWriteSequence()) - readIter.getDataIndex();
 
-        readIter.advanceCirculations(this->m_writeIterator.getCurrentNumberOfCirculations() -
-                                     readIter.getCurrentNumberOfCirculations() - 1);
+    auto bufferSize = static_cast<std::ptrdiff_t>(this->size());
 
 
 
-        // Next we need to know if the write
-        // iterator is pointing somewhere in
-        // the buffer that's ahead of where
-        // the read iterator is pointing in the
-        // buffer
+    if(distanceFromWriteSequence > bufferSize)
+    {
+        // This means that the writer has
+        // lapped the specified read iterator,
+        // maybe even multiple times over
 
-        // In this case we need the read iterator
-        // to be pointing to a place in the buffer
-        // ahead of where the write iterator
-        // is pointing, since the read iterator
-        // is one circulation behind the write
-        // iterator
+        // We advance the read iterator so
+        // that it points to the oldest data
+        // point still in the buffer, which is
+        // exactly one buffer length behind the
+        // spot where the writer is about to write
 
-        auto actualDistanceInTheBufferFromReadIterToWriteIter = this->m_writeIterator.actualDistanceInTheBufferFromAnotherIterator(readIter);
+        readIter.advance(distanceFromWriteSequence - bufferSize);
 
-        if(actualDistanceInTheBufferFromReadIterToWriteIter > 0)
-        {
-            // The means the write iterator
-            // is ahead in the buffer, so
-            // we advance the read iterator
-            // to make it point to the spot
-            // where the write iterator is
-            // about to write
-
-            readIter += actualDistanceInTheBufferFromReadIterToWriteIter;
-        }
+        return static_cast<std::size_t>(distanceFromWriteSequence - bufferSize);
     }
+
+
+
+    return std::size_t(0);
 }
-//-------------------------------------------------------------------
 
 
 
-//-------------------------------------------------------------------
-// This function reads data from
-// this buffer into an output
-// buffer given by output iterators
-//-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
-
-template<typename blAnotherDataType,
-         typename blAnotherDataPtr,
-         typename blAnotherBufferPtr,
-         typename blAnotherBufferRoiPtr,
-         std::size_t blDifferentMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::read(const int& id,
-                                                                                                          blBuffer_8<blAnotherDataType,blAnotherDataPtr,blAnotherBufferPtr,blAnotherBufferRoiPtr,blDifferentMaxNumOfDimensions>& outputBuffer)
+inline std::uint64_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::adjustReaderCursor(blReaderSlot& readerSlot)
 {
-    // First we grab a hold of
-    // the corresponding read(id)
-    // iterator
+    // Only the reader itself ever moves
+    // its cursor, so a relaxed load is
+    // enough to get our own cursor back
 
-    auto& iter = readIterator(id);
+    std::uint64_t cursor = readerSlot.m_cursor.load(std::memory_order_relaxed);
 
+    std::uint64_t writeSequence = this->publishedWriteSequence();
 
 
-    // Find the amount of
-    // data to copy
 
-    auto amountOfDataToCopy = this->m_writeIterator - iter;
+    // We keep track of the furthest
+    // behind the writer this reader
+    // has ever been
 
+    std::uint64_t lag = (writeSequence > cursor) ? (writeSequence - cursor) : std::uint64_t(0);
 
+    if(lag > readerSlot.m_peakLag.load(std::memory_order_relaxed))
+        readerSlot.m_peakLag.store(lag,std::memory_order_relaxed);
 
-    // Now we copy from this
-    // buffer into the supplied
-    // output buffer
 
-    std::copy(iter,this->m_writeIterator,outputBuffer.writeIterator());
 
+    if(writeSequence > cursor + this->size())
+    {
+        // The writer lapped this reader,
+        // so we move the cursor to the
+        // oldest data point still in the
+        // buffer, and we account for the
+        // data the reader missed
 
+        std::uint64_t numberOfElementsLost = writeSequence - this->size() - cursor;
 
-    // Finally we advance both the
-    // write iterator of the output
-    // buffer as well as the read iterator
-    // of this buffer by the amount of data
-    // we just copied
+        readerSlot.m_numberOfElementsLost.store(readerSlot.m_numberOfElementsLost.load(std::memory_order_relaxed) + numberOfElementsLost,
+                                                std::memory_order_relaxed);
 
-    outputBuffer.advance_writeIterator(amountOfDataToCopy);
-    iter.advance(amountOfDataToCopy);
+        readerSlot.m_numberOfLaps.store(readerSlot.m_numberOfLaps.load(std::memory_order_relaxed) + 1,
+                                        std::memory_order_relaxed);
 
+        cursor = writeSequence - this->size();
+
+        readerSlot.m_cursor.store(cursor,std::memory_order_release);
+    }
 
 
-    // Return the amount of data
-    // we copied
 
-    return amountOfDataToCopy;
+    return cursor;
 }
-//-------------------------------------------------------------------
 
 
 
-//-------------------------------------------------------------------
-// This function reads data from
-// this buffer into an output
-// buffer given by output iterators
-//-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
-
-template<typename blOutputIteratorType>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::read(const int& id,
-                                                                                                          const blOutputIteratorType& beginOutput,
-                                                                                                          const blOutputIteratorType& endOutput)
+inline void blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::advanceReaderCursor(blReaderSlot& readerSlot,
+                                                                                                                              const std::uint64_t& cursor)
 {
-    // First we grab a hold of
-    // the corresponding read(id)
-    // iterator
+    readerSlot.m_cursor.store(cursor,std::memory_order_release);
 
-    auto& iter = readIterator(id);
+    this->notifyBlockedWriters();
+}
+//-------------------------------------------------------------------
 
 
 
-    // Iterator used to iterate
-    // over output buffer
+//-------------------------------------------------------------------
+// These functions return the number
+// of data points that have been
+// published but not yet read
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-    blOutputIteratorType outputIter = beginOutput;
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::numberOfElementsAvailableToRead(const circular_iterator& readIter)const
+{
+    if(readIter.getDataIndex() < 0)
+        return numberOfElementsAvailableFromCursor(std::uint64_t(0));
 
+    return numberOfElementsAvailableFromCursor(static_cast<std::uint64_t>(readIter.getDataIndex()));
+}
 
 
-    // Number of elements read from
-    // this buffer into the specified
-    // buffer
 
-    std::size_t numberOfElementsRead = std::size_t(0);
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::numberOfElementsAvailableToRead(const blReaderHandle& handle)const
+{
+    const blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
 
+    if(readerSlot == nullptr)
+        return std::size_t(0);
 
+    return numberOfElementsAvailableFromCursor(readerSlot->m_cursor.load(std::memory_order_relaxed));
+}
 
-    // Let's copy the data elements
-    // one element at a time
 
-    while((iter != this->m_writeIterator) && (outputIter != endOutput))
-    {
-        (*outputIter) = (*iter);
 
-        ++iter;
-        ++outputIter;
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-        ++numberOfElementsRead;
-    }
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::numberOfElementsAvailableFromCursor(const std::uint64_t& cursor)const
+{
+    std::uint64_t writeSequence = this->publishedWriteSequence();
 
 
 
-    // We're done, we return
-    // the number of elements
-    // that were read from this
-    // buffer into the output
-    // buffer
+    // A reader can never read more
+    // than one full buffer worth of
+    // data, and can never read ahead
+    // of the writer
 
-    return numberOfElementsRead;
+    if(writeSequence <= cursor)
+        return std::size_t(0);
+
+    return static_cast<std::size_t>(std::min(writeSequence - cursor,static_cast<std::uint64_t>(this->size())));
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// This function reads unformatted
-// raw data from this buffer and
-// copies it into the specified buffer
+// These functions return a snapshot of a reader's statistics
 //-------------------------------------------------------------------
 template<typename blDataType,
          typename blDataPtr,
          typename blBufferPtr,
          typename blBufferRoiPtr,
-         std::size_t blMaxNumOfDimensions>
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions>::read(const int& id,
-                                                                                                          char* outputBuffer,
-                                                                                                          const std::size_t& outputBufferLength)
+inline blReaderStatistics blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::readerStatistics(const blReaderHandle& handle)const
 {
-    // First we grab a hold of
-    // the corresponding read(id)
-    // iterator
+    blReaderStatistics statistics;
 
-    auto& iter = readIterator(id);
+    const blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
 
+    if(readerSlot == nullptr)
+        return statistics;
 
 
-    // We then calculate how many
-    // data points are available
-    // to us that haven't been read
-    // yet by this read(id) iterator
 
-    std::size_t howManyPointsAreAvailableToRead = this->m_writeIterator - iter;
+    statistics.m_numberOfElementsLost = readerSlot->m_numberOfElementsLost.load(std::memory_order_relaxed);
+    statistics.m_numberOfLaps = readerSlot->m_numberOfLaps.load(std::memory_order_relaxed);
+    statistics.m_peakLagInElements = readerSlot->m_peakLag.load(std::memory_order_relaxed);
 
 
 
-    // We then read the data points
-    // remembering that we cannot
-    // read more than the specified
-    // buffer length
+    // The current lag is how far the
+    // reader's cursor is behind the
+    // published write sequence
 
-    if(howManyPointsAreAvailableToRead * sizeof(blDataType) < outputBufferLength)
-    {
-        // In this case, we can straight
-        // out copy all the available
-        // data points without worrying
-        // about overstepping our boundaries
-        // in the user specified buffer
+    std::uint64_t cursor = readerSlot->m_cursor.load(std::memory_order_acquire);
 
-        std::copy(iter,this->m_writeIterator,reinterpret_cast<blDataType*>(outputBuffer));
+    std::uint64_t writeSequence = this->publishedWriteSequence();
 
+    statistics.m_lagInElements = (writeSequence > cursor) ? (writeSequence - cursor) : std::uint64_t(0);
+    statistics.m_lagInBytes = statistics.m_lagInElements * sizeof(blDataType);
 
+    statistics.m_peakLagInElements = std::max(statistics.m_peakLagInElements,statistics.m_lagInElements);
 
-        // Advance the read iterator
 
-        iter += howManyPointsAreAvailableToRead;
 
+    return statistics;
+}
 
 
-        // Return the number of bytes read
 
-        return howManyPointsAreAvailableToRead * sizeof(blDataType);
-    }
-    else
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blReaderStatistics blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::readerStatistics(const int& id)const
+{
+    return readerStatistics(this->m_controlBlock->m_readers.findReader(id));
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to lower the lowest reader watermark
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline void blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::lowerReaderWatermark(const std::uint64_t& watermark)
+{
+    std::uint64_t lowestWatermark = this->m_controlBlock->m_lowestReaderWatermark.load(std::memory_order_relaxed);
+
+    while(watermark < lowestWatermark &&
+          !this->m_controlBlock->m_lowestReaderWatermark.compare_exchange_weak(lowestWatermark,
+                                                              watermark,
+                                                              std::memory_order_seq_cst,
+                                                              std::memory_order_relaxed))
     {
-        // This means that the buffer we
-        // need to copy the read data into
-        // is smaller than the amount of
-        // available data to read from this
-        // buffer
+    }
 
-        std::copy(iter,iter + (outputBufferLength / sizeof(blDataType)),reinterpret_cast<blDataType*>(outputBuffer));
 
 
+    // This fence makes our watermark
+    // visible before we check for data
+    // again, the writer doesn't fence
+    // on its side, so a reader it misses
+    // relies on its parks being bounded
+    // by "blWaitStrategy::maxParkTime"
 
-        // Advance the read iterator
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+//-------------------------------------------------------------------
 
-        iter += (outputBufferLength / sizeof(blDataType));
 
 
+//-------------------------------------------------------------------
+// These functions wait for data and then read it
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
 
-        // Return the number of bytes read
+template<typename blOutputIteratorType>
 
-        return outputBufferLength;
-    }
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::read_wait(const blReaderHandle& handle,
+                                                                                                                           const blOutputIteratorType& beginOutput,
+                                                                                                                           const blOutputIteratorType& endOutput,
+                                                                                                                           const std::size_t& minimumNumberOfElements,
+                                                                                                                           const std::chrono::nanoseconds& timeout)
+{
+    blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
+
+    if(readerSlot == nullptr)
+        return std::size_t(0);
+
+
+
+    // The watermark is the write sequence
+    // at which enough data will be available
+    // to this reader
+
+    std::size_t numberOfElementsToWaitFor = std::min(minimumNumberOfElements,this->size());
+
+    std::uint64_t watermark = adjustReaderCursor(*readerSlot) + numberOfElementsToWaitFor;
+
+
+
+    // While waiting, the reader keeps
+    // lowering the buffer's watermark
+    // before checking for data, because
+    // the writer clears the watermark
+    // every time it wakes readers up
+
+    auto isEnoughDataAvailable = [this,&watermark]()
+    {
+        if(this->publishedWriteSequence() >= watermark)
+            return true;
+
+        lowerReaderWatermark(watermark);
+
+        return this->publishedWriteSequence() >= watermark;
+    };
+
+    auto now = std::chrono::steady_clock::now();
+
+    auto deadline = std::chrono::steady_clock::time_point::max();
+
+    if(timeout < deadline - now)
+        deadline = now + timeout;
+
+    this->m_controlBlock->m_readersWaitStrategy.waitUntil(isEnoughDataAvailable,deadline);
+
+
+
+    // Whether we timed out or not, we
+    // read whatever data is available
+
+    return read(handle,beginOutput,endOutput);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::read_wait(const int& id,
+                                                                                                                           const blOutputIteratorType& beginOutput,
+                                                                                                                           const blOutputIteratorType& endOutput,
+                                                                                                                           const std::size_t& minimumNumberOfElements,
+                                                                                                                           const std::chrono::nanoseconds& timeout)
+{
+    return read_wait(registerReader(id),beginOutput,endOutput,minimumNumberOfElements,timeout);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// These functions read data from
+// this buffer into an output buffer
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blAnotherDataType,
+         typename blAnotherDataPtr,
+         typename blAnotherBufferPtr,
+         typename blAnotherBufferRoiPtr,
+         std::size_t blDifferentMaxNumOfDimensions,
+         typename blAnotherAllocator>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::read(const blReaderHandle& handle,
+                                                                                                                      blBuffer_8<blAnotherDataType,blAnotherDataPtr,blAnotherBufferPtr,blAnotherBufferRoiPtr,blDifferentMaxNumOfDimensions,blAnotherAllocator>& outputBuffer)
+{
+    // First we grab a hold
+    // of the reader's slot
+
+    blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
+
+    if(readerSlot == nullptr || outputBuffer.size() == 0)
+        return std::size_t(0);
+
+    std::uint64_t cursor = adjustReaderCursor(*readerSlot);
+
+
+
+    // Find the amount of
+    // data to copy
+
+    std::size_t amountOfDataToCopy = numberOfElementsAvailableFromCursor(cursor);
+
+
+
+    // We copy straight from this buffer's
+    // memory into the output buffer's memory
+    // reserved by its own reserve function,
+    // (which takes care of the output buffer's
+    // write mode) at most one output buffer
+    // length at a time, so that each side is
+    // copied in at most two contiguous chunks
+    //
+    // The reservation is made without waiting,
+    // so that an output buffer whose overrun
+    // policy is BLOCK can't stall this thread,
+    // and we stop as soon as the output buffer
+    // doesn't take (all of) a chunk, the data
+    // it didn't take being left for the next read
+
+    std::size_t amountOfDataCopied = 0;
+
+    while(amountOfDataCopied < amountOfDataToCopy)
+    {
+        std::size_t amountOfDataToCopyRightNow = std::min(amountOfDataToCopy - amountOfDataCopied,outputBuffer.size());
+
+        auto sourceSpans = std::as_const(*this).contiguousSpans(cursor + amountOfDataCopied,
+                                                                amountOfDataToCopyRightNow);
+
+        auto reservation = outputBuffer.reserve_no_wait(amountOfDataToCopyRightNow);
+
+        if(reservation.empty())
+            break;
+
+        copySpans(sourceSpans,reservation);
+
+        std::size_t amountOfDataCopiedRightNow = outputBuffer.commit(reservation);
+
+        amountOfDataCopied += amountOfDataCopiedRightNow;
+
+        if(amountOfDataCopiedRightNow < amountOfDataToCopyRightNow)
+            break;
+    }
+
+
+
+    // We advance the reader's cursor
+    // past the data we actually copied
+
+    advanceReaderCursor(*readerSlot,cursor + amountOfDataCopied);
+
+
+
+    // Return the amount of data
+    // we copied
+
+    return amountOfDataCopied;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blAnotherDataType,
+         typename blAnotherDataPtr,
+         typename blAnotherBufferPtr,
+         typename blAnotherBufferRoiPtr,
+         std::size_t blDifferentMaxNumOfDimensions,
+         typename blAnotherAllocator>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::read(const int& id,
+                                                                                                                      blBuffer_8<blAnotherDataType,blAnotherDataPtr,blAnotherBufferPtr,blAnotherBufferRoiPtr,blDifferentMaxNumOfDimensions,blAnotherAllocator>& outputBuffer)
+{
+    return read(registerReader(id),outputBuffer);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// These functions read data from
+// this buffer into an output
+// buffer given by output iterators
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::read(const blReaderHandle& handle,
+                                                                                                                      const blOutputIteratorType& beginOutput,
+                                                                                                                      const blOutputIteratorType& endOutput)
+{
+    // First we grab a hold
+    // of the reader's slot
+
+    blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
+
+    if(readerSlot == nullptr)
+        return std::size_t(0);
+
+    std::uint64_t cursor = adjustReaderCursor(*readerSlot);
+
+
+
+    // We only read up to the
+    // published write sequence,
+    // which in this buffer's memory
+    // is covered by at most two
+    // contiguous spans
+
+    auto sourceSpans = std::as_const(*this).contiguousSpans(cursor,
+                                                            numberOfElementsAvailableFromCursor(cursor));
+
+
+
+    // Number of elements read from
+    // this buffer into the specified
+    // buffer
+
+    std::size_t numberOfElementsRead = std::size_t(0);
+
+
+
+    if constexpr(blIsContiguousOutputIterator<blOutputIteratorType,blDataType>::value &&
+                 std::is_trivially_copyable<blDataType>::value)
+    {
+        // The output is contiguous memory
+        // of our own data type, so we copy
+        // each span with a single memcpy
+
+        std::size_t outputBufferLength = static_cast<std::size_t>(std::distance(beginOutput,endOutput));
+
+        if(outputBufferLength > 0)
+        {
+            blDataType* outputPtr = std::addressof(*beginOutput);
+
+            numberOfElementsRead = copySpans(sourceSpans,
+                                             blSpan<blDataType>(outputPtr,outputBufferLength));
+        }
+    }
+    else
+    {
+        // Otherwise we copy the data
+        // elements one at a time, but
+        // straight from this buffer's
+        // memory, so without going
+        // through circular iterators
+
+        blOutputIteratorType outputIter = beginOutput;
+
+        for(const auto& sourceSpan : {sourceSpans.m_first,sourceSpans.m_second})
+        {
+            for(std::size_t i = 0; i < sourceSpan.size() && outputIter != endOutput; ++i)
+            {
+                (*outputIter) = sourceSpan[i];
+
+                ++outputIter;
+
+                ++numberOfElementsRead;
+            }
+        }
+    }
+
+
+
+    // We advance the reader's cursor
+    // by the amount of data read
+
+    advanceReaderCursor(*readerSlot,cursor + numberOfElementsRead);
+
+
+
+    // We're done, we return
+    // the number of elements
+    // that were read from this
+    // buffer into the output
+    // buffer
+
+    return numberOfElementsRead;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::read(const int& id,
+                                                                                                                      const blOutputIteratorType& beginOutput,
+                                                                                                                      const blOutputIteratorType& endOutput)
+{
+    return read(registerReader(id),beginOutput,endOutput);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// These functions read unformatted
+// raw data from this buffer and
+// copy it into the specified buffer
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::read(const blReaderHandle& handle,
+                                                                                                                      char* outputBuffer,
+                                                                                                                      const std::size_t& outputBufferLength)
+{
+    // First we grab a hold
+    // of the reader's slot
+
+    blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
+
+    if(readerSlot == nullptr)
+        return std::size_t(0);
+
+    std::uint64_t cursor = adjustReaderCursor(*readerSlot);
+
+
+
+    // We then calculate how many
+    // data points are available
+    // to us that haven't been read
+    // yet by this reader, remembering
+    // that we cannot read more than
+    // the specified buffer length
+
+    std::size_t howManyPointsToRead = std::min(numberOfElementsAvailableFromCursor(cursor),
+                                               outputBufferLength / sizeof(blDataType));
+
+
+
+    // We copy the raw data in
+    // at most two contiguous chunks
+    // (an empty span has no data
+    // pointer to copy from)
+
+    auto sourceSpans = std::as_const(*this).contiguousSpans(cursor,howManyPointsToRead);
+
+    if(!sourceSpans.m_first.empty())
+    {
+        std::memcpy(outputBuffer,
+                    sourceSpans.m_first.data(),
+                    sourceSpans.m_first.size_in_bytes());
+    }
+
+    if(!sourceSpans.m_second.empty())
+    {
+        std::memcpy(outputBuffer + sourceSpans.m_first.size_in_bytes(),
+                    sourceSpans.m_second.data(),
+                    sourceSpans.m_second.size_in_bytes());
+    }
+
+
+
+    // Advance the reader's cursor
+
+    advanceReaderCursor(*readerSlot,cursor + howManyPointsToRead);
+
+
+
+    // Return the number of bytes read
+
+    return howManyPointsToRead * sizeof(blDataType);
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::read(const int& id,
+                                                                                                                      char* outputBuffer,
+                                                                                                                      const std::size_t& outputBufferLength)
+{
+    return read(registerReader(id),outputBuffer,outputBufferLength);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to copy data from a pair of source
+// spans into a pair of destination spans (or a single
+// destination span), returning the number of data
+// points copied
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blSourceDataType,
+         typename blDestinationDataType>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::copySpans(const blSpanPair<blSourceDataType>& source,
+                                                                                                                           const blSpanPair<blDestinationDataType>& destination)
+{
+    std::size_t numberOfElementsCopied = 0;
+
+
+
+    // We walk both pairs of spans at
+    // the same time, copying the biggest
+    // contiguous chunk we can each time,
+    // which adds up to at most three chunks
+
+    const blSpan<blSourceDataType>* sourceSpan = &source.m_first;
+    const blSpan<blDestinationDataType>* destinationSpan = &destination.m_first;
+
+    std::size_t sourceOffset = 0;
+    std::size_t destinationOffset = 0;
+
+    while(true)
+    {
+        // Move on to the second spans
+        // once the first ones are used up
+
+        if(sourceOffset == sourceSpan->size() && sourceSpan == &source.m_first)
+        {
+            sourceSpan = &source.m_second;
+            sourceOffset = 0;
+        }
+
+        if(destinationOffset == destinationSpan->size() && destinationSpan == &destination.m_first)
+        {
+            destinationSpan = &destination.m_second;
+            destinationOffset = 0;
+        }
+
+
+
+        std::size_t numberOfElementsToCopy = std::min(sourceSpan->size() - sourceOffset,
+                                                      destinationSpan->size() - destinationOffset);
+
+        if(numberOfElementsToCopy == 0)
+            break;
+
+
+
+        if constexpr(std::is_same<typename std::remove_cv<blSourceDataType>::type,blDestinationDataType>::value &&
+                     std::is_trivially_copyable<blDestinationDataType>::value)
+        {
+            std::memcpy(destinationSpan->data() + destinationOffset,
+                        sourceSpan->data() + sourceOffset,
+                        numberOfElementsToCopy * sizeof(blDestinationDataType));
+        }
+        else
+        {
+            std::copy(sourceSpan->data() + sourceOffset,
+                      sourceSpan->data() + sourceOffset + numberOfElementsToCopy,
+                      destinationSpan->data() + destinationOffset);
+        }
+
+
+
+        sourceOffset += numberOfElementsToCopy;
+        destinationOffset += numberOfElementsToCopy;
+
+        numberOfElementsCopied += numberOfElementsToCopy;
+    }
+
+
+
+    return numberOfElementsCopied;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+template<typename blSourceDataType,
+         typename blDestinationDataType>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::copySpans(const blSpanPair<blSourceDataType>& source,
+                                                                                                                           const blSpan<blDestinationDataType>& destination)
+{
+    blSpanPair<blDestinationDataType> destinationSpans;
+
+    destinationSpans.m_first = destination;
+
+    return copySpans(source,destinationSpans);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Zero-copy read functions
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blSpanPair<const blDataType> blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::peek(const blReaderHandle& handle)
+{
+    blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
+
+    if(readerSlot == nullptr)
+        return blSpanPair<const blDataType>();
+
+    std::uint64_t cursor = adjustReaderCursor(*readerSlot);
+
+
+
+    // The spans cover everything from
+    // the reader's cursor up to the
+    // published write sequence
+
+    return std::as_const(*this).contiguousSpans(cursor,numberOfElementsAvailableFromCursor(cursor));
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline blSpanPair<const blDataType> blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::peek(const int& id)
+{
+    return peek(registerReader(id));
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::release(const blReaderHandle& handle,
+                                                                                                                         const std::size_t& numberOfElements)
+{
+    blReaderSlot* readerSlot = this->m_controlBlock->m_readers.slot(handle);
+
+    if(readerSlot == nullptr)
+        return std::size_t(0);
+
+    std::uint64_t cursor = readerSlot->m_cursor.load(std::memory_order_relaxed);
+
+
+
+    // We can't release data
+    // that hasn't been written yet
+
+    std::size_t numberOfElementsToRelease = std::min(numberOfElements,numberOfElementsAvailableFromCursor(cursor));
+
+    advanceReaderCursor(*readerSlot,cursor + numberOfElementsToRelease);
+
+
+
+    return numberOfElementsToRelease;
+}
+
+
+
+template<typename blDataType,
+         typename blDataPtr,
+         typename blBufferPtr,
+         typename blBufferRoiPtr,
+         std::size_t blMaxNumOfDimensions,
+         typename blAllocator>
+
+inline std::size_t blBuffer_8<blDataType,blDataPtr,blBufferPtr,blBufferRoiPtr,blMaxNumOfDimensions,blAllocator>::release(const int& id,
+                                                                                                                         const std::size_t& numberOfElements)
+{
+    return release(registerReader(id),numberOfElements);
 }
 //-------------------------------------------------------------------
 
@@ -20,6 +20,12 @@
 //                     -- "size" function for getting the total size
 //                        of the buffer
 //
+//                  -- The iterator keeps track of its wrapped position
+//                     in the buffer and of the lap it is in (the range
+//                     of data indexes sharing its number of circulations),
+//                     small moves just compare against the lap and wrap
+//                     the position around, only large jumps divide
+//
 //
 //
 // AUTHOR:          Vincenzo Barbato
@@ -110,9 +116,14 @@ public: // Constructors and destructors
 
 
 
-    // Copy constructor
+    // Copy constructor and assignment
+    // operator (every member, including
+    // the cached lap and wrap state, is
+    // copied as is)
+
+    blCircularIterator(const blCircularIterator<blBufferType,blBufferPtr>& circularIterator) = default;
 
-    blCircularIterator(const blCircularIterator<blBufferType,blBufferPtr>& circularIterator);
+    blCircularIterator<blBufferType,blBufferPtr>& operator=(const blCircularIterator<blBufferType,blBufferPtr>& circularIterator) = default;
 
 
 
@@ -326,6 +337,28 @@ protected: // Protected functions
 
 
 
+    // Function used to update the lap the
+    // iterator is in for a given lap length
+    // (the buffer's size, or the ROI's size
+    // for ROI iterators), stepping into the
+    // neighbouring lap without dividing when
+    // the iterator only just left its lap
+
+    void                                                updateCurrentLap(const std::ptrdiff_t& lapLength);
+
+    void                                                setLapRange();
+
+
+
+    // Function used to get the wrapped
+    // buffer index of the iterator, which
+    // is only worked out with a modulo if
+    // the tracked one is out of date
+
+    std::size_t                                         getWrappedIndex()const;
+
+
+
 protected: // Protected variables
 
 
@@ -371,6 +404,30 @@ protected: // Protected variables
     // point
 
     std::ptrdiff_t                                      m_maxNumberOfCirculations;
+
+
+
+    // The lap the iterator is in, as the
+    // range of (non-wrapped) data indexes
+    // sharing the current number of
+    // circulations, along with the starting
+    // index and the lap length it was
+    // worked out for
+
+    std::ptrdiff_t                                      m_lapBeginIndex = 0;
+    std::ptrdiff_t                                      m_lapEndIndex = 0;
+    std::ptrdiff_t                                      m_lapStartIndex = 0;
+    std::ptrdiff_t                                      m_lapLength = 0;
+
+
+
+    // The wrapped buffer index, along
+    // with the data index and the buffer
+    // size it was worked out for
+
+    std::size_t                                         m_wrappedIndex = 0;
+    std::ptrdiff_t                                      m_wrappedDataIndex = 0;
+    std::size_t                                         m_wrappedLength = 0;
 };
 //-------------------------------------------------------------------
 
@@ -392,20 +449,6 @@ inline blCircularIterator<blBufferType,blBufferPtr>::blCircularIterator(const bl
 
     m_maxNumberOfCirculations = maxNumberOfCirculations;
 }
-
-
-
-template<typename blBufferType,
-         typename blBufferPtr>
-
-inline blCircularIterator<blBufferType,blBufferPtr>::blCircularIterator(const blCircularIterator<blBufferType,blBufferPtr>& circularIterator)
-{
-    m_bufferPtr = circularIterator.getBufferPtr();
-    m_dataIndex = circularIterator.getDataIndex();
-    m_startIndex = circularIterator.getStartIndex();
-    m_currentNumberOfCirculations = circularIterator.getCurrentNumberOfCirculations();
-    m_maxNumberOfCirculations = circularIterator.getMaxNumberOfCirculations();
-}
 //-------------------------------------------------------------------
 
 
@@ -521,7 +564,14 @@ template<typename blBufferType,
 
 inline std::size_t blCircularIterator<blBufferType,blBufferPtr>::remainingContiguousSpots()const
 {
-    return this->m_bufferPtr->size() - circ_index(this->m_dataIndex,this->m_bufferPtr->size());
+    // In a mirrored buffer a whole
+    // buffer's worth of spots is
+    // contiguous from anywhere
+
+    if(this->m_bufferPtr->isMirrored())
+        return this->m_bufferPtr->size();
+
+    return this->m_bufferPtr->size() - this->getWrappedIndex();
 }
 
 
@@ -531,7 +581,10 @@ template<typename blBufferType,
 
 inline std::size_t blCircularIterator<blBufferType,blBufferPtr>::remainingContiguousBytes()const
 {
-    return sizeof(blDataType) * (this->m_bufferPtr->size() - circ_index(this->m_dataIndex,m_bufferPtr->size()));
+    if(this->m_bufferPtr->isMirrored())
+        return sizeof(blDataType) * this->m_bufferPtr->size();
+
+    return sizeof(blDataType) * (this->m_bufferPtr->size() - this->getWrappedIndex());
 }
 //-------------------------------------------------------------------
 
@@ -837,7 +890,149 @@ template<typename blBufferType,
 
 inline void blCircularIterator<blBufferType,blBufferPtr>::updateCurrentNumberOfCirculations()
 {
-    m_currentNumberOfCirculations = (m_dataIndex - m_startIndex) / std::ptrdiff_t(m_bufferPtr->size());
+    if(!m_bufferPtr)
+        return;
+
+    std::size_t bufferSize = m_bufferPtr->size();
+
+    if(bufferSize == 0)
+        return;
+
+    updateCurrentLap(std::ptrdiff_t(bufferSize));
+
+
+
+    // Moves shorter than the buffer
+    // wrap the tracked index around
+    // with a single comparison
+
+    std::ptrdiff_t movement = m_dataIndex - m_wrappedDataIndex;
+
+    if(m_wrappedLength == bufferSize &&
+       movement > -std::ptrdiff_t(bufferSize) &&
+       movement < std::ptrdiff_t(bufferSize))
+    {
+        std::ptrdiff_t wrappedIndex = std::ptrdiff_t(m_wrappedIndex) + movement;
+
+        if(wrappedIndex < 0)
+            wrappedIndex += std::ptrdiff_t(bufferSize);
+        else if(wrappedIndex >= std::ptrdiff_t(bufferSize))
+            wrappedIndex -= std::ptrdiff_t(bufferSize);
+
+        m_wrappedIndex = std::size_t(wrappedIndex);
+    }
+    else
+    {
+        m_wrappedIndex = circ_index(m_dataIndex,bufferSize);
+        m_wrappedLength = bufferSize;
+    }
+
+    m_wrappedDataIndex = m_dataIndex;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to update the lap the
+// iterator is in, that is the range of
+// data indexes sharing its number of
+// circulations
+//-------------------------------------------------------------------
+template<typename blBufferType,
+         typename blBufferPtr>
+
+inline void blCircularIterator<blBufferType,blBufferPtr>::updateCurrentLap(const std::ptrdiff_t& lapLength)
+{
+    if(m_dataIndex >= m_lapBeginIndex &&
+       m_dataIndex < m_lapEndIndex &&
+       m_startIndex == m_lapStartIndex &&
+       lapLength == m_lapLength)
+    {
+        return;
+    }
+
+    if(lapLength <= 0)
+        return;
+
+
+
+    // Laps are at least as long as the
+    // lap length, so an iterator that just
+    // left its lap is in the next or in the
+    // previous one, otherwise we divide
+
+    if(m_startIndex == m_lapStartIndex && lapLength == m_lapLength)
+    {
+        if(m_dataIndex >= m_lapEndIndex)
+            ++m_currentNumberOfCirculations;
+        else
+            --m_currentNumberOfCirculations;
+
+        setLapRange();
+
+        if(m_dataIndex >= m_lapBeginIndex && m_dataIndex < m_lapEndIndex)
+            return;
+    }
+
+    m_lapStartIndex = m_startIndex;
+    m_lapLength = lapLength;
+
+    m_currentNumberOfCirculations = (m_dataIndex - m_startIndex) / lapLength;
+
+    setLapRange();
+}
+
+
+
+template<typename blBufferType,
+         typename blBufferPtr>
+
+inline void blCircularIterator<blBufferType,blBufferPtr>::setLapRange()
+{
+    // The number of circulations is the
+    // truncated (towards zero) quotient of
+    // the iterated length by the lap length,
+    // so the lap around the starting index
+    // stretches to both sides of it
+
+    std::ptrdiff_t lapOrigin = m_lapStartIndex + m_currentNumberOfCirculations * m_lapLength;
+
+    if(m_currentNumberOfCirculations > 0)
+    {
+        m_lapBeginIndex = lapOrigin;
+        m_lapEndIndex = lapOrigin + m_lapLength;
+    }
+    else if(m_currentNumberOfCirculations < 0)
+    {
+        m_lapBeginIndex = lapOrigin - m_lapLength + 1;
+        m_lapEndIndex = lapOrigin + 1;
+    }
+    else
+    {
+        m_lapBeginIndex = lapOrigin - m_lapLength + 1;
+        m_lapEndIndex = lapOrigin + m_lapLength;
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to get the wrapped
+// buffer index of the iterator
+//-------------------------------------------------------------------
+template<typename blBufferType,
+         typename blBufferPtr>
+
+inline std::size_t blCircularIterator<blBufferType,blBufferPtr>::getWrappedIndex()const
+{
+    std::size_t bufferSize = m_bufferPtr->size();
+
+    if(m_wrappedDataIndex == m_dataIndex && m_wrappedLength == bufferSize)
+        return m_wrappedIndex;
+
+    return circ_index(m_dataIndex,bufferSize);
 }
 //-------------------------------------------------------------------
 
@@ -864,7 +1059,7 @@ inline typename blCircularIterator<blBufferType,blBufferPtr>::blDataType& blCirc
     if(this->hasReachedEndOfBuffer())
         return (*this->m_bufferPtr)[m_bufferPtr->size()];
 
-    return (*this->m_bufferPtr)[this->circ_index(m_dataIndex,this->m_bufferPtr->size())];
+    return (*this->m_bufferPtr)[this->getWrappedIndex()];
 }
 
 
@@ -885,7 +1080,7 @@ inline const typename blCircularIterator<blBufferType,blBufferPtr>::blDataType&
     if(this->hasReachedEndOfBuffer())
         return (*this->m_bufferPtr)[m_bufferPtr->size()];
 
-    return (*this->m_bufferPtr)[this->circ_index(m_dataIndex,this->m_bufferPtr->size())];
+    return (*this->m_bufferPtr)[this->getWrappedIndex()];
 }
 
 
@@ -909,7 +1104,7 @@ inline typename blCircularIterator<blBufferType,blBufferPtr>::blDataPtr blCircul
     if(this->hasReachedEndOfBuffer())
         return blDataPtr(&(*this->m_bufferPtr)[m_bufferPtr->size()]);
 
-    return blDataPtr(&(*this->m_bufferPtr)[this->circ_index(m_dataIndex,this->m_bufferPtr->size())]);
+    return blDataPtr(&(*this->m_bufferPtr)[this->getWrappedIndex()]);
 }
 
 
@@ -933,7 +1128,7 @@ inline const typename blCircularIterator<blBufferType,blBufferPtr>::blDataPtr bl
     if(this->hasReachedEndOfBuffer())
         return blDataPtr(&(*this->m_bufferPtr)[m_bufferPtr->size()]);
 
-    return blDataPtr(&(*this->m_bufferPtr)[this->circ_index(m_dataIndex,this->m_bufferPtr->size())]);
+    return blDataPtr(&(*this->m_bufferPtr)[this->getWrappedIndex()]);
 }
 //-------------------------------------------------------------------
 
@@ -954,6 +1149,14 @@ inline void blCircularIterator<blBufferType,blBufferPtr>::setDataIndex(const int
     m_startIndex = dataIndex;
 
     m_currentNumberOfCirculations = 0;
+
+
+
+    // The tracked lap may belong to
+    // another number of circulations
+
+    m_lapBeginIndex = 0;
+    m_lapEndIndex = 0;
 }
 //-------------------------------------------------------------------
 
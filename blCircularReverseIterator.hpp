@@ -70,9 +70,12 @@ public: // Constructors and destructors
 
 
 
-    // Copy constructor
+    // Copy constructor and
+    // assignment operator
 
-    blCircularReverseIterator(const blCircularReverseIterator<blBufferType,blBufferPtr>& reverseIterator);
+    blCircularReverseIterator(const blCircularReverseIterator<blBufferType,blBufferPtr>& reverseIterator) = default;
+
+    blCircularReverseIterator<blBufferType,blBufferPtr>& operator=(const blCircularReverseIterator<blBufferType,blBufferPtr>& reverseIterator) = default;
 
 
 
@@ -171,16 +174,6 @@ inline blCircularReverseIterator<blBufferType,blBufferPtr>::blCircularReverseIte
         this->setDataIndex(bufferPtr->size() - 1 - dataIndex);
     }
 }
-
-
-
-template<typename blBufferType,
-         typename blBufferPtr>
-
-inline blCircularReverseIterator<blBufferType,blBufferPtr>::blCircularReverseIterator(const blCircularReverseIterator<blBufferType,blBufferPtr>& reverseIterator)
-                                                                                      : blCircularIterator<blBufferType,blBufferPtr>(reverseIterator)
-{
-}
 //-------------------------------------------------------------------
 
 
@@ -28,6 +28,11 @@
 //                     for a buffer so that functions can work on user specified
 //                     parts of the buffer and not the entire data
 //
+//                  -- Each dimension can also be given a pitch alignment,
+//                     in which case the dimension is padded in memory to
+//                     a multiple of it, so that for example every column
+//                     of an image starts at an aligned address
+//
 //                  -- This class defines multiple redundant functions
 //                     with common names for the first 3 dimensions
 //                     such as (rows,cols,pages), (size1,size2,size3),
@@ -129,6 +134,8 @@ public: // Sizes/Lengths functions
     // current total size/length
     // of the buffer
     // size0 * size1 * size2 * ... * sizeN
+    // (pitch0 * pitch1 * ... * pitchN
+    // when dimensions are padded)
 
     const std::size_t&                                      size()const;
     const std::size_t&                                      length()const;
@@ -149,6 +156,17 @@ public: // Sizes/Lengths functions
 
 
 
+    // Function used to get the sizes
+    // of a single unit of all dimensions
+    // at once, that is the strides that
+    // turn n-dimensional indexes into a
+    // data index (they're cached every
+    // time the sizes change)
+
+    const std::array<std::size_t,blNumberOfDimensions>&     sizesOfSingleUnits()const;
+
+
+
     // Function used to get the
     // sizes/lengths vector
 
@@ -202,6 +220,36 @@ public: // Sizes/Lengths functions
 
 
 
+    // Functions used to get the pitch of
+    // each dimension, that is the number
+    // of data points the dimension spans
+    // in memory, and to get/set the pitch
+    // alignments they're calculated from
+    //
+    // -- The pitch of a dimension is its size
+    //    rounded up to a multiple of its pitch
+    //    alignment (one by default, which means
+    //    no padding)
+    //
+    // -- Aligning the pitch of the first dimension
+    //    is enough to make every unit of the other
+    //    dimensions (every column of an image and
+    //    every page of a volume) start aligned
+    //
+    // -- The total size of the buffer and the
+    //    sizes of single units count the padding
+
+    const std::array<std::size_t,blNumberOfDimensions>&     pitches()const;
+    const std::size_t&                                      pitch(const std::size_t& dimension)const;
+
+    const std::size_t&                                      pitchAlignment(const std::size_t& dimension)const;
+
+    void                                                    setPitchAlignments();
+    void                                                    setPitchAlignment(const std::size_t& whichDimension,
+                                                                              const std::size_t& pitchAlignment);
+
+
+
     // These functions are used to
     // manually set the offsets for
     // a Region Of Interest (ROI)
@@ -263,6 +311,16 @@ protected: // Protected variables
 
 
 
+    // The pitches of each dimension
+    // and the alignments they're
+    // rounded up to
+
+    std::array<std::size_t,blNumberOfDimensions>            m_pitches;
+
+    std::array<std::size_t,blNumberOfDimensions>            m_pitchAlignments;
+
+
+
     // Total length of the buffer
     // size0 * size1 * size2 * ... * sizeN
 
@@ -302,6 +360,12 @@ inline blDimensionalProperties<blNumberOfDimensions>::blDimensionalProperties()
     for(auto& i : m_sizes)
         i = 0;
 
+    for(auto& i : m_pitches)
+        i = 0;
+
+    for(auto& i : m_pitchAlignments)
+        i = 1;
+
     for(auto& i: m_sizesOfSingleUnitsInEachDimenion)
         i = 0;
 
@@ -522,6 +586,65 @@ inline void blDimensionalProperties<blNumberOfDimensions>::setDimensionalSize(co
 
 
 
+//-------------------------------------------------------------------
+// Functions used to get the pitches
+// and get/set the pitch alignments
+//-------------------------------------------------------------------
+template<std::size_t blNumberOfDimensions>
+
+inline const std::array<std::size_t,blNumberOfDimensions>& blDimensionalProperties<blNumberOfDimensions>::pitches()const
+{
+    return m_pitches;
+}
+
+
+
+template<std::size_t blNumberOfDimensions>
+
+inline const std::size_t& blDimensionalProperties<blNumberOfDimensions>::pitch(const std::size_t& dimension)const
+{
+    return m_pitches[dimension];
+}
+
+
+
+template<std::size_t blNumberOfDimensions>
+
+inline const std::size_t& blDimensionalProperties<blNumberOfDimensions>::pitchAlignment(const std::size_t& dimension)const
+{
+    return m_pitchAlignments[dimension];
+}
+
+
+
+template<std::size_t blNumberOfDimensions>
+
+inline void blDimensionalProperties<blNumberOfDimensions>::setPitchAlignments()
+{
+    // We default all alignments to
+    // one so that nothing is padded
+
+    for(auto& i : m_pitchAlignments)
+        i = static_cast<std::size_t>(1);
+
+    calculateTotalSizeOfBuffer();
+}
+
+
+
+template<std::size_t blNumberOfDimensions>
+
+inline void blDimensionalProperties<blNumberOfDimensions>::setPitchAlignment(const std::size_t& whichDimension,
+                                                                             const std::size_t& pitchAlignment)
+{
+    m_pitchAlignments[whichDimension] = (pitchAlignment == 0 ? std::size_t(1) : pitchAlignment);
+
+    calculateTotalSizeOfBuffer();
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 //These functions are used to
 // manually set the offsets for
@@ -788,12 +911,19 @@ template<std::size_t blNumberOfDimensions>
 
 inline std::size_t blDimensionalProperties<blNumberOfDimensions>::sizeOfSingleUnitInSpecificDimension(const std::size_t& whichDimension)const
 {
-    std::size_t unitSize = 1;
+    if(whichDimension < blNumberOfDimensions)
+        return m_sizesOfSingleUnitsInEachDimenion[whichDimension];
+
+    return m_size;
+}
+
 
-    for(std::size_t i = 0; i < whichDimension; ++i)
-        unitSize *= m_sizes[i];
 
-    return unitSize;
+template<std::size_t blNumberOfDimensions>
+
+inline const std::array<std::size_t,blNumberOfDimensions>& blDimensionalProperties<blNumberOfDimensions>::sizesOfSingleUnits()const
+{
+    return m_sizesOfSingleUnitsInEachDimenion;
 }
 //-------------------------------------------------------------------
 
@@ -807,10 +937,19 @@ template<std::size_t blNumberOfDimensions>
 
 inline void blDimensionalProperties<blNumberOfDimensions>::calculateTotalSizeOfBuffer()
 {
-    // First we calculate the
+    // First we pad each dimension
+    // to a multiple of its pitch
+    // alignment
+
+    for(std::size_t i = 0; i < m_sizes.size(); ++i)
+        m_pitches[i] = ((m_sizes[i] + m_pitchAlignments[i] - 1) / m_pitchAlignments[i]) * m_pitchAlignments[i];
+
+
+
+    // Then we calculate the
     // overall buffer size
     // depending on the specified
-    // buffer lengths
+    // buffer lengths (and padding)
 
     if(m_sizes.size() == 0)
         m_size = 0;
@@ -819,8 +958,8 @@ inline void blDimensionalProperties<blNumberOfDimensions>::calculateTotalSizeOfB
 
 
 
-    for(const std::size_t& dimensionalSize : m_sizes)
-        m_size *= dimensionalSize;
+    for(const std::size_t& dimensionalPitch : m_pitches)
+        m_size *= dimensionalPitch;
 
 
 
@@ -832,14 +971,13 @@ inline void blDimensionalProperties<blNumberOfDimensions>::calculateTotalSizeOfB
     // the size of a single column unit is rows
     // the size of single a row unit is 1
 
+    std::size_t unitSize = 1;
+
     for(std::size_t i = 0; i < m_sizes.size(); ++i)
     {
-        m_sizesOfSingleUnitsInEachDimenion[i] = 1;
+        m_sizesOfSingleUnitsInEachDimenion[i] = unitSize;
 
-        for(std::size_t j = 0; j < i; ++j)
-        {
-            m_sizesOfSingleUnitsInEachDimenion[i] *= m_sizes[j];
-        }
+        unitSize *= m_pitches[i];
     }
 }
 //-------------------------------------------------------------------
@@ -0,0 +1,412 @@
+#ifndef BL_FIXEDSIZEBUFFER_HPP
+#define BL_FIXEDSIZEBUFFER_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blFixedSizeBuffer.hpp
+// CLASS:           blFixedSizeBuffer
+// BASE CLASS:      blBuffer
+//
+//
+//
+// PURPOSE:         -- Based on blBuffer, blFixedSizeBuffer is a buffer
+//                     whose rank and lengths are known at compile time
+//                     and are given as template parameters, for example
+//                     blFixedSizeBuffer<float,480,640> is a 480x640 image
+//
+//                  -- Because the lengths never change, the sizes of a
+//                     single unit of each dimension (the strides) are
+//                     constexpr, so the at/operator() functions unroll
+//                     and constant-fold into the same code as a
+//                     hand-written "col*rows + row"
+//
+//                  -- The buffer is created by its constructor, the
+//                     functions that would change its lengths or pad
+//                     its dimensions (create, wrap, setPitchAlignment
+//                     and setAllocator) are deleted
+//
+//                  -- This class is defined within the blBufferLIB
+//                     namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- blBuffer and all its dependencies
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+// Include the base class
+
+#include "blBuffer.hpp"
+
+
+
+// Used to unroll the
+// index calculations
+
+#include <array>
+#include <utility>
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to calculate at compile
+// time the size of a single unit of each
+// dimension given all the lengths
+//-------------------------------------------------------------------
+template<std::size_t...blLengths>
+
+inline constexpr std::array<std::size_t,sizeof...(blLengths)> blCalculateSizesOfSingleUnits()
+{
+    std::array<std::size_t,sizeof...(blLengths)> lengths = {blLengths...};
+
+    std::array<std::size_t,sizeof...(blLengths)> unitSizes = {};
+
+    std::size_t unitSize = 1;
+
+    for(std::size_t i = 0; i < sizeof...(blLengths); ++i)
+    {
+        unitSizes[i] = unitSize;
+
+        unitSize *= lengths[i];
+    }
+
+    return unitSizes;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// blFixedSizeBuffer -- Class definition
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t...blLengths>
+
+class blFixedSizeBuffer : public blBuffer<blDataType,sizeof...(blLengths)>
+{
+    static_assert(sizeof...(blLengths) > 0,
+                  "blFixedSizeBuffer needs at least one dimension");
+
+    static_assert(((blLengths > 0) && ...),
+                  "blFixedSizeBuffer's lengths have to be greater than zero");
+
+
+
+public: // Public constants
+
+
+
+    // The number of dimensions, the
+    // length of each dimension and
+    // the total number of data points
+
+    static constexpr std::size_t                                numberOfDimensions = sizeof...(blLengths);
+
+    static constexpr std::array<std::size_t,sizeof...(blLengths)> lengths = {blLengths...};
+
+    static constexpr std::size_t                                numberOfDataPoints = (std::size_t(1) * ... * blLengths);
+
+
+
+    // The size of a single unit of each
+    // dimension, that is the strides used
+    // to turn n-dimensional indexes into
+    // a data index
+
+    static constexpr std::array<std::size_t,sizeof...(blLengths)> sizesOfSingleUnits = blCalculateSizesOfSingleUnits<blLengths...>();
+
+
+
+public: // Constructors and destructors
+
+
+
+    // Default constructor (it creates
+    // the buffer, optionally leaving
+    // trivial data types uninitialized)
+
+    blFixedSizeBuffer(const blInitializationMode& initializationMode = blInitializationMode::VALUE_INITIALIZED);
+
+
+
+    // Copy and move constructors
+
+    blFixedSizeBuffer(const blFixedSizeBuffer<blDataType,blLengths...>& fixedSizeBuffer) = default;
+
+    blFixedSizeBuffer(blFixedSizeBuffer<blDataType,blLengths...>&& fixedSizeBuffer) noexcept = default;
+
+
+
+    // Destructor
+
+    ~blFixedSizeBuffer();
+
+
+
+public: // Overloaded operators
+
+
+
+    // Copy and move assignment operators
+
+    blFixedSizeBuffer<blDataType,blLengths...>&                 operator=(const blFixedSizeBuffer<blDataType,blLengths...>& fixedSizeBuffer) = default;
+
+    blFixedSizeBuffer<blDataType,blLengths...>&                 operator=(blFixedSizeBuffer<blDataType,blLengths...>&& fixedSizeBuffer) noexcept = default;
+
+
+
+    // operator() (one index per
+    // dimension at most)
+
+    template<typename...blIntegerTypes>
+    blDataType&                                                 operator()(const blIntegerTypes&...dataIndexes);
+
+    template<typename...blIntegerTypes>
+    const blDataType&                                           operator()(const blIntegerTypes&...dataIndexes)const;
+
+
+
+public: // Public functions
+
+
+
+    // "at" functions which do the same
+    // thing as the operator(), they do
+    // not check for out of bound indexes
+
+    template<typename...blIntegerTypes>
+    blDataType&                                                 at(const blIntegerTypes&...dataIndexes);
+
+    template<typename...blIntegerTypes>
+    const blDataType&                                           at(const blIntegerTypes&...dataIndexes)const;
+
+    blDataType&                                                 at(const std::array<std::size_t,sizeof...(blLengths)>& dataIndexes);
+
+    const blDataType&                                           at(const std::array<std::size_t,sizeof...(blLengths)>& dataIndexes)const;
+
+
+
+    // Function used to turn n-dimensional
+    // indexes into a data index at compile
+    // time when the indexes are constants
+
+    template<typename...blIntegerTypes>
+    static constexpr std::size_t                                linearIndex(const blIntegerTypes&...dataIndexes);
+
+
+
+public: // Functions that would change the
+        // buffer's lengths or padding
+
+
+
+    template<typename...blArgumentTypes>
+    bool                                                        create(const blArgumentTypes&...arguments) = delete;
+
+    template<typename...blArgumentTypes>
+    void                                                        wrap(const blArgumentTypes&...arguments) = delete;
+
+    template<typename...blArgumentTypes>
+    void                                                        setPitchAlignment(const blArgumentTypes&...arguments) = delete;
+
+    template<typename...blArgumentTypes>
+    void                                                        setAllocator(const blArgumentTypes&...arguments) = delete;
+
+
+
+private: // Private functions
+
+
+
+    // Function used to expand the
+    // indexes against the strides
+
+    template<std::size_t...blDimensions,
+             typename...blIntegerTypes>
+    static constexpr std::size_t                                linearIndexOf(std::index_sequence<blDimensions...>,
+                                                                              const blIntegerTypes&...dataIndexes);
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Default constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t...blLengths>
+
+inline blFixedSizeBuffer<blDataType,blLengths...>::blFixedSizeBuffer(const blInitializationMode& initializationMode)
+                                                 : blBuffer<blDataType,sizeof...(blLengths)>()
+{
+    this->setInitializationMode(initializationMode);
+
+    blBuffer<blDataType,sizeof...(blLengths)>::create(blLengths...);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t...blLengths>
+
+inline blFixedSizeBuffer<blDataType,blLengths...>::~blFixedSizeBuffer()
+{
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// operator() and "at" functions
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t...blLengths>
+
+template<typename...blIntegerTypes>
+
+inline blDataType& blFixedSizeBuffer<blDataType,blLengths...>::operator()(const blIntegerTypes&...dataIndexes)
+{
+    return this->data()[linearIndex(dataIndexes...)];
+}
+
+
+
+template<typename blDataType,
+         std::size_t...blLengths>
+
+template<typename...blIntegerTypes>
+
+inline const blDataType& blFixedSizeBuffer<blDataType,blLengths...>::operator()(const blIntegerTypes&...dataIndexes)const
+{
+    return this->data()[linearIndex(dataIndexes...)];
+}
+
+
+
+template<typename blDataType,
+         std::size_t...blLengths>
+
+template<typename...blIntegerTypes>
+
+inline blDataType& blFixedSizeBuffer<blDataType,blLengths...>::at(const blIntegerTypes&...dataIndexes)
+{
+    return this->data()[linearIndex(dataIndexes...)];
+}
+
+
+
+template<typename blDataType,
+         std::size_t...blLengths>
+
+template<typename...blIntegerTypes>
+
+inline const blDataType& blFixedSizeBuffer<blDataType,blLengths...>::at(const blIntegerTypes&...dataIndexes)const
+{
+    return this->data()[linearIndex(dataIndexes...)];
+}
+
+
+
+template<typename blDataType,
+         std::size_t...blLengths>
+
+inline blDataType& blFixedSizeBuffer<blDataType,blLengths...>::at(const std::array<std::size_t,sizeof...(blLengths)>& dataIndexes)
+{
+    std::size_t dataIndex = 0;
+
+    for(std::size_t i = 0; i < numberOfDimensions; ++i)
+        dataIndex += dataIndexes[i] * sizesOfSingleUnits[i];
+
+    return this->data()[dataIndex];
+}
+
+
+
+template<typename blDataType,
+         std::size_t...blLengths>
+
+inline const blDataType& blFixedSizeBuffer<blDataType,blLengths...>::at(const std::array<std::size_t,sizeof...(blLengths)>& dataIndexes)const
+{
+    std::size_t dataIndex = 0;
+
+    for(std::size_t i = 0; i < numberOfDimensions; ++i)
+        dataIndex += dataIndexes[i] * sizesOfSingleUnits[i];
+
+    return this->data()[dataIndex];
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to turn n-dimensional
+// indexes into a data index
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t...blLengths>
+
+template<typename...blIntegerTypes>
+
+inline constexpr std::size_t blFixedSizeBuffer<blDataType,blLengths...>::linearIndex(const blIntegerTypes&...dataIndexes)
+{
+    static_assert(sizeof...(blIntegerTypes) <= sizeof...(blLengths),
+                  "blFixedSizeBuffer::linearIndex -- more indexes than the buffer has dimensions");
+
+    return linearIndexOf(std::index_sequence_for<blIntegerTypes...>(),dataIndexes...);
+}
+
+
+
+template<typename blDataType,
+         std::size_t...blLengths>
+
+template<std::size_t...blDimensions,
+         typename...blIntegerTypes>
+
+inline constexpr std::size_t blFixedSizeBuffer<blDataType,blLengths...>::linearIndexOf(std::index_sequence<blDimensions...>,
+                                                                                      const blIntegerTypes&...dataIndexes)
+{
+    return (std::size_t(0) + ... + (static_cast<std::size_t>(dataIndexes) * std::get<blDimensions>(sizesOfSingleUnits)));
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_FIXEDSIZEBUFFER_HPP
@@ -0,0 +1,674 @@
+#ifndef BL_MAPPEDMEMORY_HPP
+#define BL_MAPPEDMEMORY_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blMappedMemory.hpp
+// CLASS:           blMappedMemory
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         -- The blMappedMemory class owns a piece of memory
+//                     mapped directly with mmap, so that big buffers can
+//                     choose the size of the pages backing them
+//
+//                  -- The blPageType enumeration is used to ask for:
+//
+//                     -- REGULAR:          The system's regular pages
+//
+//                     -- TRANSPARENT_HUGE: Regular pages the kernel is
+//                                          advised (madvise) to promote
+//                                          to transparent huge pages
+//
+//                     -- HUGE:             Explicit huge pages (MAP_HUGETLB),
+//                                          which have to be reserved by the
+//                                          system administrator beforehand
+//
+//                  -- When the requested type of page is not available,
+//                     the memory falls back to the next type down the list
+//                     (HUGE -> TRANSPARENT_HUGE -> REGULAR), and the
+//                     "sizeOfPages" function reports the size of the pages
+//                     actually obtained
+//
+//                     -- NOTE: Transparent huge pages are promoted by the
+//                              kernel in the background, so in that case
+//                              the reported size is the huge page size the
+//                              kernel was allowed to use for the memory
+//
+//                  -- The class also provides static functions used to
+//                     prefault any memory (optionally splitting the work
+//                     across threads) and to lock it in memory, so that
+//                     the first writes to a new buffer don't take page
+//                     faults
+//
+//                  -- This class is defined within the namespace "blBufferLIB"
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- mmap and madvise
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <string>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+
+
+// Used to map the memory
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+#endif
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Enumeration used to ask for the
+// type of pages backing the memory
+//-------------------------------------------------------------------
+enum class blPageType
+{
+    REGULAR,
+    TRANSPARENT_HUGE,
+    HUGE
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blMappedMemory declaration
+//-------------------------------------------------------------------
+class blMappedMemory
+{
+public: // Constructors and destructors
+
+
+
+    // Default constructor
+
+    blMappedMemory() = default;
+
+
+
+    // The memory is owned, so it
+    // can be moved but not copied
+
+    blMappedMemory(const blMappedMemory& mappedMemory) = delete;
+
+    blMappedMemory(blMappedMemory&& mappedMemory)
+    {
+        swap(mappedMemory);
+    }
+
+
+
+    // Destructor
+
+    ~blMappedMemory()
+    {
+        release();
+    }
+
+
+
+public: // Overloaded operators
+
+
+
+    // Assignment operators
+
+    blMappedMemory&                                         operator=(const blMappedMemory& mappedMemory) = delete;
+
+    blMappedMemory&                                         operator=(blMappedMemory&& mappedMemory)
+    {
+        if(this != &mappedMemory)
+        {
+            release();
+            swap(mappedMemory);
+        }
+
+        return *this;
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Function used to allocate "numberOfBytes"
+    // bytes of zeroed memory backed by the
+    // requested type of pages (or the best
+    // type available)
+    //
+    // It returns false if the memory
+    // could not be mapped at all
+
+    bool                                                    allocate(const std::size_t& numberOfBytes,
+                                                                     const blPageType& pageType);
+
+
+
+    // Function used to unmap
+    // the memory
+
+    void                                                    release();
+
+
+
+    // Functions used to get the memory,
+    // its size, the size of the pages
+    // backing it, the type of pages it
+    // was asked for and whether there's any
+
+    void*                                                   data()const{return m_data;}
+    const std::size_t&                                      size()const{return m_size;}
+    const std::size_t&                                      sizeOfPages()const{return m_sizeOfPages;}
+    const blPageType&                                       pageType()const{return m_pageType;}
+    bool                                                    isAllocated()const{return m_data != nullptr;}
+
+
+
+    // Functions used to get the size of
+    // the system's regular pages and of
+    // its default huge pages
+
+    static std::size_t                                      pageSize();
+    static std::size_t                                      hugePageSize();
+
+
+
+    // Function used to know whether the kernel
+    // is allowed to back advised memory with
+    // transparent huge pages, either private
+    // memory or shared memory (shmem, memfd)
+
+    static bool                                             areTransparentHugePagesAvailable(const bool& forSharedMemory);
+
+
+
+    // Function used to advise the kernel to back
+    // the huge page aligned part of a memory range
+    // with transparent huge pages
+    //
+    // It returns the size of the pages the kernel
+    // may now use for that range, and can be used
+    // on any mapped memory (for example a boost
+    // shared memory segment)
+
+    static std::size_t                                      adviseTransparentHugePages(void* data,
+                                                                                       const std::size_t& numberOfBytes,
+                                                                                       const bool& isSharedMemory);
+
+
+
+    // Function used to prefault a memory range,
+    // so that its pages are allocated and mapped
+    // before anybody uses them
+    //
+    // -- The range is split in "numberOfThreads"
+    //    parts, each prefaulted by its own thread
+    //
+    // -- Each page is populated for writing with
+    //    madvise(MADV_POPULATE_WRITE) when available,
+    //    otherwise by touching it, writing its first
+    //    byte back to itself only if "canTouchData"
+    //    is true (nobody else is using the memory)
+    //    and reading it otherwise
+
+    static void                                             prefault(void* data,
+                                                                     const std::size_t& numberOfBytes,
+                                                                     const std::size_t& numberOfThreads,
+                                                                     const bool& canTouchData);
+
+
+
+    // Functions used to lock/unlock a
+    // memory range in memory (mlock), so
+    // that its pages are never swapped out
+    //
+    // The lock function returns false if
+    // the range could not be locked (usually
+    // because of RLIMIT_MEMLOCK)
+
+    static bool                                             lock(const void* data,
+                                                                 const std::size_t& numberOfBytes);
+
+    static void                                             unlock(const void* data,
+                                                                   const std::size_t& numberOfBytes);
+
+
+
+private: // Private functions
+
+
+
+    void                                                    swap(blMappedMemory& mappedMemory)
+    {
+        std::swap(m_mapping,mappedMemory.m_mapping);
+        std::swap(m_sizeOfMapping,mappedMemory.m_sizeOfMapping);
+        std::swap(m_data,mappedMemory.m_data);
+        std::swap(m_size,mappedMemory.m_size);
+        std::swap(m_sizeOfPages,mappedMemory.m_sizeOfPages);
+        std::swap(m_pageType,mappedMemory.m_pageType);
+    }
+
+
+
+private: // Private variables
+
+
+
+    // The whole mapping and the
+    // memory handed out to the user
+
+    void*                                                   m_mapping = nullptr;
+    std::size_t                                             m_sizeOfMapping = 0;
+
+    void*                                                   m_data = nullptr;
+    std::size_t                                             m_size = 0;
+
+
+
+    // The size of the pages backing
+    // the memory and the type of pages
+    // it was asked for
+
+    std::size_t                                             m_sizeOfPages = 0;
+    blPageType                                              m_pageType = blPageType::REGULAR;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to allocate the memory
+//-------------------------------------------------------------------
+inline bool blMappedMemory::allocate(const std::size_t& numberOfBytes,
+                                     const blPageType& pageType)
+{
+    release();
+
+    if(numberOfBytes == 0)
+        return false;
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    auto roundUp = [](const std::size_t& value,const std::size_t& alignment)
+    {
+        return ((value + alignment - 1) / alignment) * alignment;
+    };
+
+
+
+    // First we try explicit huge
+    // pages if we were asked to
+
+#ifdef MAP_HUGETLB
+    if(pageType == blPageType::HUGE)
+    {
+        std::size_t sizeOfMapping = roundUp(numberOfBytes,hugePageSize());
+
+        void* mapping = mmap(nullptr,sizeOfMapping,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,-1,0);
+
+        if(mapping != MAP_FAILED)
+        {
+            m_mapping = mapping;
+            m_sizeOfMapping = sizeOfMapping;
+            m_data = mapping;
+            m_size = numberOfBytes;
+            m_sizeOfPages = hugePageSize();
+            m_pageType = pageType;
+
+            return true;
+        }
+    }
+#endif
+
+
+
+    // Otherwise we map regular pages,
+    // aligning the memory to a huge page
+    // boundary when asking for transparent
+    // huge pages so the kernel can back
+    // all of it with huge pages
+
+    std::size_t alignment = (pageType == blPageType::REGULAR ? pageSize() : hugePageSize());
+
+    std::size_t sizeOfData = roundUp(numberOfBytes,pageSize());
+    std::size_t sizeOfMapping = sizeOfData + (alignment - pageSize());
+
+    void* mapping = mmap(nullptr,sizeOfMapping,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+
+    if(mapping == MAP_FAILED)
+        return false;
+
+
+
+    // We give back the unaligned
+    // head and tail of the mapping
+
+    std::uintptr_t beginningOfMapping = reinterpret_cast<std::uintptr_t>(mapping);
+    std::uintptr_t beginningOfData = roundUp(beginningOfMapping,alignment);
+
+    std::size_t sizeOfHead = beginningOfData - beginningOfMapping;
+    std::size_t sizeOfTail = sizeOfMapping - sizeOfHead - sizeOfData;
+
+    if(sizeOfHead > 0)
+        munmap(mapping,sizeOfHead);
+
+    if(sizeOfTail > 0)
+        munmap(reinterpret_cast<void*>(beginningOfData + sizeOfData),sizeOfTail);
+
+    m_mapping = reinterpret_cast<void*>(beginningOfData);
+    m_sizeOfMapping = sizeOfData;
+    m_data = m_mapping;
+    m_size = numberOfBytes;
+    m_sizeOfPages = pageSize();
+    m_pageType = pageType;
+
+    if(pageType != blPageType::REGULAR)
+        m_sizeOfPages = adviseTransparentHugePages(m_data,m_sizeOfMapping,false);
+
+    return true;
+
+#else
+
+    return false;
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to release the memory
+//-------------------------------------------------------------------
+inline void blMappedMemory::release()
+{
+#if defined(__unix__) || defined(__APPLE__)
+
+    if(m_mapping != nullptr)
+        munmap(m_mapping,m_sizeOfMapping);
+
+#endif
+
+    m_mapping = nullptr;
+    m_sizeOfMapping = 0;
+    m_data = nullptr;
+    m_size = 0;
+    m_sizeOfPages = 0;
+    m_pageType = blPageType::REGULAR;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get the page sizes
+//-------------------------------------------------------------------
+inline std::size_t blMappedMemory::pageSize()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    static const std::size_t sizeOfPage = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+    static const std::size_t sizeOfPage = 4096;
+#endif
+
+    return sizeOfPage;
+}
+
+
+
+inline std::size_t blMappedMemory::hugePageSize()
+{
+    // On linux the default huge page
+    // size is listed in /proc/meminfo
+    // (in kB), otherwise we assume 2MB
+
+    static const std::size_t sizeOfHugePage = []()
+    {
+        std::size_t sizeInKB = 2048;
+
+        std::ifstream memoryInfo("/proc/meminfo");
+        std::string field;
+
+        while(memoryInfo >> field)
+        {
+            if(field == "Hugepagesize:")
+            {
+                memoryInfo >> sizeInKB;
+                break;
+            }
+        }
+
+        return sizeInKB * 1024;
+    }();
+
+    return sizeOfHugePage;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to deal with
+// transparent huge pages
+//-------------------------------------------------------------------
+inline bool blMappedMemory::areTransparentHugePagesAvailable(const bool& forSharedMemory)
+{
+    // The selected setting is the one in
+    // brackets, for example "always [madvise] never"
+
+    std::ifstream settings(forSharedMemory ?
+                           "/sys/kernel/mm/transparent_hugepage/shmem_enabled" :
+                           "/sys/kernel/mm/transparent_hugepage/enabled");
+
+    std::string setting;
+
+    while(settings >> setting)
+    {
+        if(setting.front() == '[')
+            return setting != "[never]" && setting != "[deny]";
+    }
+
+    return false;
+}
+
+
+
+inline std::size_t blMappedMemory::adviseTransparentHugePages(void* data,
+                                                              const std::size_t& numberOfBytes,
+                                                              const bool& isSharedMemory)
+{
+#if defined(MADV_HUGEPAGE)
+
+    // Only whole huge pages
+    // can be huge pages
+
+    std::uintptr_t beginningOfData = reinterpret_cast<std::uintptr_t>(data);
+    std::uintptr_t endOfData = beginningOfData + numberOfBytes;
+
+    std::uintptr_t beginningOfHugePages = ((beginningOfData + hugePageSize() - 1) / hugePageSize()) * hugePageSize();
+    std::uintptr_t endOfHugePages = (endOfData / hugePageSize()) * hugePageSize();
+
+    if(endOfHugePages > beginningOfHugePages &&
+       madvise(reinterpret_cast<void*>(beginningOfHugePages),endOfHugePages - beginningOfHugePages,MADV_HUGEPAGE) == 0 &&
+       areTransparentHugePagesAvailable(isSharedMemory))
+    {
+        return hugePageSize();
+    }
+
+#endif
+
+    return pageSize();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to prefault a memory range
+//-------------------------------------------------------------------
+inline void blMappedMemory::prefault(void* data,
+                                     const std::size_t& numberOfBytes,
+                                     const std::size_t& numberOfThreads,
+                                     const bool& canTouchData)
+{
+    if(data == nullptr || numberOfBytes == 0)
+        return;
+
+
+
+    // Each thread gets a whole
+    // number of pages
+
+    std::size_t numberOfPages = (numberOfBytes + pageSize() - 1) / pageSize();
+    std::size_t numberOfParts = std::max<std::size_t>(1,std::min(numberOfThreads,numberOfPages));
+    std::size_t numberOfPagesPerPart = (numberOfPages + numberOfParts - 1) / numberOfParts;
+
+    char* beginningOfData = static_cast<char*>(data);
+    char* endOfData = beginningOfData + numberOfBytes;
+
+    auto prefaultPart = [=](const std::size_t& whichPart)
+    {
+        char* beginningOfPart = beginningOfData + whichPart * numberOfPagesPerPart * pageSize();
+        char* endOfPart = std::min(endOfData,beginningOfPart + numberOfPagesPerPart * pageSize());
+
+        if(beginningOfPart >= endOfPart)
+            return;
+
+#if defined(MADV_POPULATE_WRITE)
+
+        // The kernel can populate the
+        // pages without touching them
+        // (madvise needs a page aligned
+        // beginning)
+
+        std::uintptr_t beginningOfPages = (reinterpret_cast<std::uintptr_t>(beginningOfPart) / pageSize()) * pageSize();
+
+        if(madvise(reinterpret_cast<void*>(beginningOfPages),
+                   reinterpret_cast<std::uintptr_t>(endOfPart) - beginningOfPages,
+                   MADV_POPULATE_WRITE) == 0)
+        {
+            return;
+        }
+
+#endif
+
+        // Otherwise we touch the first byte
+        // of the range in every page (and its
+        // last byte, which might be on one
+        // more page when the range is not
+        // page aligned)
+
+        auto touch = [&](char* byte)
+        {
+            volatile char* touchedByte = byte;
+
+            if(canTouchData)
+                *touchedByte = *touchedByte;
+            else
+                static_cast<void>(*touchedByte);
+        };
+
+        for(char* byte = beginningOfPart; byte < endOfPart; byte += pageSize())
+            touch(byte);
+
+        touch(endOfPart - 1);
+    };
+
+
+
+    std::vector<std::thread> prefaultingThreads;
+
+    for(std::size_t whichPart = 1; whichPart < numberOfParts; ++whichPart)
+        prefaultingThreads.emplace_back(prefaultPart,whichPart);
+
+    prefaultPart(0);
+
+    for(auto& prefaultingThread : prefaultingThreads)
+        prefaultingThread.join();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to lock/unlock a memory range
+//-------------------------------------------------------------------
+inline bool blMappedMemory::lock(const void* data,
+                                 const std::size_t& numberOfBytes)
+{
+#if defined(__unix__) || defined(__APPLE__)
+
+    if(data != nullptr && numberOfBytes > 0)
+        return mlock(data,numberOfBytes) == 0;
+
+#endif
+
+    return false;
+}
+
+
+
+inline void blMappedMemory::unlock(const void* data,
+                                   const std::size_t& numberOfBytes)
+{
+#if defined(__unix__) || defined(__APPLE__)
+
+    if(data != nullptr && numberOfBytes > 0)
+        munlock(data,numberOfBytes);
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_MAPPEDMEMORY_HPP
@@ -0,0 +1,544 @@
+#ifndef BL_MIRROREDMEMORY_HPP
+#define BL_MIRROREDMEMORY_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blMirroredMemory.hpp
+// CLASS:           blMirroredMemory
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         -- The blMirroredMemory class owns a piece of memory
+//                     whose physical pages are mapped twice, back to back,
+//                     in virtual memory, so that writing to data[i] also
+//                     writes to data[i + size] and any window of up to
+//                     "size" bytes starting anywhere in the first half is
+//                     contiguous, even when it wraps around the end
+//
+//                  -- Circular buffers use it so that data wrapping around
+//                     the end of the buffer can be copied with one memcpy
+//                     and processed by vectorized loops as one span
+//
+//                  -- The mirrored memory has to be a whole number of pages,
+//                     "allocate" fails otherwise (and on platforms without
+//                     memfd_create/shm_open and mmap), so users can fall back
+//                     to regular memory
+//
+//                  -- The memory can ask for huge pages (see blMappedMemory),
+//                     explicit huge pages need the memory to be a whole
+//                     number of huge pages, otherwise the memory falls back
+//                     to regular pages, "sizeOfPages" reports what it got
+//
+//                  -- The static "mapMirrored" function does the same for a
+//                     region of an already existing shared memory file, used
+//                     by blPosixSharedMemoryBuffer
+//
+//                  -- This class is defined within the namespace "blBufferLIB"
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- blMappedMemory
+//                  -- memfd_create (linux) or shm_open and mmap
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <string>
+#include <atomic>
+
+
+
+// Used for the page types
+// and page sizes
+
+#include "blMappedMemory.hpp"
+
+
+
+// Used to create and
+// map the memory twice
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#endif
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blMirroredMemory declaration
+//-------------------------------------------------------------------
+class blMirroredMemory
+{
+public: // Constructors and destructors
+
+
+
+    // Default constructor
+
+    blMirroredMemory() = default;
+
+
+
+    // The memory is owned, so it
+    // can be moved but not copied
+
+    blMirroredMemory(const blMirroredMemory& mirroredMemory) = delete;
+
+    blMirroredMemory(blMirroredMemory&& mirroredMemory)
+    {
+        std::swap(m_data,mirroredMemory.m_data);
+        std::swap(m_size,mirroredMemory.m_size);
+        std::swap(m_sizeOfPages,mirroredMemory.m_sizeOfPages);
+        std::swap(m_pageType,mirroredMemory.m_pageType);
+    }
+
+
+
+    // Destructor
+
+    ~blMirroredMemory()
+    {
+        release();
+    }
+
+
+
+public: // Overloaded operators
+
+
+
+    // Assignment operators
+
+    blMirroredMemory&                                       operator=(const blMirroredMemory& mirroredMemory) = delete;
+
+    blMirroredMemory&                                       operator=(blMirroredMemory&& mirroredMemory)
+    {
+        if(this != &mirroredMemory)
+        {
+            release();
+
+            std::swap(m_data,mirroredMemory.m_data);
+            std::swap(m_size,mirroredMemory.m_size);
+            std::swap(m_sizeOfPages,mirroredMemory.m_sizeOfPages);
+            std::swap(m_pageType,mirroredMemory.m_pageType);
+        }
+
+        return *this;
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Function used to allocate "numberOfBytes"
+    // bytes of zeroed, mirrored memory backed
+    // by the requested type of pages (or the
+    // best type available)
+    //
+    // -- It returns false (and leaves the
+    //    memory released) if numberOfBytes
+    //    is not a multiple of the page size
+    //    or the memory could not be mapped
+
+    bool                                                    allocate(const std::size_t& numberOfBytes,
+                                                                     const blPageType& pageType = blPageType::REGULAR);
+
+
+
+    // Function used to unmap
+    // the memory
+
+    void                                                    release();
+
+
+
+    // Functions used to get the memory,
+    // its size (the size of one copy),
+    // the size of the pages backing it,
+    // the type of pages it was asked for
+    // and whether there's any
+
+    void*                                                   data()const{return m_data;}
+    const std::size_t&                                      size()const{return m_size;}
+    const std::size_t&                                      sizeOfPages()const{return m_sizeOfPages;}
+    const blPageType&                                       pageType()const{return m_pageType;}
+    bool                                                    isAllocated()const{return m_data != nullptr;}
+
+
+
+    // Function used to get the size
+    // of a virtual memory page
+
+    static std::size_t                                      pageSize();
+
+
+
+    // Functions used to map a region of a
+    // shared memory file so that its data
+    // part is mirrored
+    //
+    // -- The file's bytes [0,offsetOfData + numberOfBytes)
+    //    are mapped first, directly followed by
+    //    the data part [offsetOfData,offsetOfData + numberOfBytes)
+    //    mapped once more
+    //
+    // -- offsetOfData and numberOfBytes have to
+    //    be multiples of the size of the file's
+    //    pages, which is also the alignment of
+    //    the mapping
+    //
+    // -- mapMirrored returns nullptr on failure
+    //    and the mapping has to be released with
+    //    unmapMirrored using the same sizes
+
+    static void*                                            mapMirrored(const int& fileDescriptor,
+                                                                        const std::size_t& offsetOfData,
+                                                                        const std::size_t& numberOfBytes,
+                                                                        const std::size_t& sizeOfPages = pageSize());
+
+    static void                                             unmapMirrored(void* mapping,
+                                                                          const std::size_t& offsetOfData,
+                                                                          const std::size_t& numberOfBytes);
+
+
+
+private: // Private functions
+
+
+
+    // Function used to create an unnamed
+    // memory file to back the memory,
+    // made of explicit huge pages if
+    // asked to (linux only)
+
+    static int                                              createMemoryFile(const bool& shouldUseHugePages);
+
+
+
+private: // Private variables
+
+
+
+    // The first copy of the memory
+    // and its size in bytes
+
+    void*                                                   m_data = nullptr;
+    std::size_t                                             m_size = 0;
+
+
+
+    // The size of the pages backing
+    // the memory and the type of pages
+    // it was asked for
+
+    std::size_t                                             m_sizeOfPages = 0;
+    blPageType                                              m_pageType = blPageType::REGULAR;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to allocate the mirrored memory
+//-------------------------------------------------------------------
+inline bool blMirroredMemory::allocate(const std::size_t& numberOfBytes,
+                                       const blPageType& pageType)
+{
+    release();
+
+    if(numberOfBytes == 0 || numberOfBytes % pageSize() != 0)
+        return false;
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    // We first try explicit huge pages if
+    // we were asked to and the memory is a
+    // whole number of them, then regular
+    // pages
+    //
+    // The memory file only lives as long
+    // as its mappings, so we close it as
+    // soon as the memory is mapped
+
+    bool shouldUseHugePages = (pageType == blPageType::HUGE && numberOfBytes % blMappedMemory::hugePageSize() == 0);
+
+    for(int attempt = (shouldUseHugePages ? 0 : 1); attempt < 2 && m_data == nullptr; ++attempt)
+    {
+        bool isUsingHugePages = (attempt == 0);
+
+        int fileDescriptor = createMemoryFile(isUsingHugePages);
+
+        if(fileDescriptor < 0)
+            continue;
+
+        std::size_t sizeOfPages = (isUsingHugePages ? blMappedMemory::hugePageSize() : pageSize());
+
+        if(ftruncate(fileDescriptor,static_cast<off_t>(numberOfBytes)) == 0)
+            m_data = mapMirrored(fileDescriptor,0,numberOfBytes,sizeOfPages);
+
+        ::close(fileDescriptor);
+
+        m_sizeOfPages = sizeOfPages;
+    }
+
+    if(m_data == nullptr)
+    {
+        m_sizeOfPages = 0;
+        return false;
+    }
+
+    m_size = numberOfBytes;
+    m_pageType = pageType;
+
+
+
+    // Regular pages can still be
+    // promoted to transparent huge
+    // pages (both copies share them)
+
+    if(pageType != blPageType::REGULAR && m_sizeOfPages == pageSize())
+    {
+        m_sizeOfPages = blMappedMemory::adviseTransparentHugePages(m_data,numberOfBytes,true);
+        blMappedMemory::adviseTransparentHugePages(static_cast<char*>(m_data) + numberOfBytes,numberOfBytes,true);
+    }
+
+    return true;
+
+#else
+
+    return false;
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to release the mirrored memory
+//-------------------------------------------------------------------
+inline void blMirroredMemory::release()
+{
+    if(m_data != nullptr)
+        unmapMirrored(m_data,0,m_size);
+
+    m_data = nullptr;
+    m_size = 0;
+    m_sizeOfPages = 0;
+    m_pageType = blPageType::REGULAR;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to get the size of a page
+//-------------------------------------------------------------------
+inline std::size_t blMirroredMemory::pageSize()
+{
+    return blMappedMemory::pageSize();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to map and unmap a
+// mirrored region of a file
+//-------------------------------------------------------------------
+inline void* blMirroredMemory::mapMirrored(const int& fileDescriptor,
+                                           const std::size_t& offsetOfData,
+                                           const std::size_t& numberOfBytes,
+                                           const std::size_t& sizeOfPages)
+{
+#if defined(__unix__) || defined(__APPLE__)
+
+    if(sizeOfPages == 0 || offsetOfData % sizeOfPages != 0 || numberOfBytes % sizeOfPages != 0)
+        return nullptr;
+
+
+
+    // First we reserve enough address
+    // space for both copies, so that
+    // nobody else can grab the addresses
+    // between the two mappings, aligned
+    // to the file's pages (huge pages
+    // have to be mapped at huge page
+    // boundaries)
+
+    std::size_t sizeOfFirstMapping = offsetOfData + numberOfBytes;
+    std::size_t sizeOfMapping = sizeOfFirstMapping + numberOfBytes;
+    std::size_t sizeOfReservation = sizeOfMapping + (sizeOfPages - pageSize());
+
+    void* reservation = mmap(nullptr,sizeOfReservation,PROT_NONE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+
+    if(reservation == MAP_FAILED)
+        return nullptr;
+
+    std::uintptr_t beginningOfReservation = reinterpret_cast<std::uintptr_t>(reservation);
+    std::uintptr_t beginningOfMapping = ((beginningOfReservation + sizeOfPages - 1) / sizeOfPages) * sizeOfPages;
+
+    std::size_t sizeOfHead = beginningOfMapping - beginningOfReservation;
+    std::size_t sizeOfTail = sizeOfReservation - sizeOfHead - sizeOfMapping;
+
+    if(sizeOfHead > 0)
+        munmap(reservation,sizeOfHead);
+
+    if(sizeOfTail > 0)
+        munmap(reinterpret_cast<void*>(beginningOfMapping + sizeOfMapping),sizeOfTail);
+
+    char* mapping = reinterpret_cast<char*>(beginningOfMapping);
+
+
+
+    // Then we map the file over the
+    // reservation, followed by its
+    // data part once more
+
+    void* firstCopy = mmap(mapping,
+                           sizeOfFirstMapping,
+                           PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_FIXED,
+                           fileDescriptor,
+                           0);
+
+    void* secondCopy = MAP_FAILED;
+
+    if(firstCopy != MAP_FAILED)
+    {
+        secondCopy = mmap(mapping + sizeOfFirstMapping,
+                          numberOfBytes,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_FIXED,
+                          fileDescriptor,
+                          static_cast<off_t>(offsetOfData));
+    }
+
+    if(firstCopy == MAP_FAILED || secondCopy == MAP_FAILED)
+    {
+        munmap(mapping,sizeOfMapping);
+        return nullptr;
+    }
+
+    return mapping;
+
+#else
+
+    return nullptr;
+
+#endif
+}
+
+
+
+inline void blMirroredMemory::unmapMirrored(void* mapping,
+                                            const std::size_t& offsetOfData,
+                                            const std::size_t& numberOfBytes)
+{
+#if defined(__unix__) || defined(__APPLE__)
+
+    if(mapping != nullptr)
+        munmap(mapping,offsetOfData + 2 * numberOfBytes);
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to create an unnamed memory file
+//-------------------------------------------------------------------
+inline int blMirroredMemory::createMemoryFile(const bool& shouldUseHugePages)
+{
+#if defined(__linux__)
+
+    unsigned int flags = MFD_CLOEXEC;
+
+    if(shouldUseHugePages)
+    {
+#ifdef MFD_HUGETLB
+        flags |= MFD_HUGETLB;
+#else
+        return -1;
+#endif
+    }
+
+    return memfd_create("blMirroredMemory",flags);
+
+#elif defined(__unix__) || defined(__APPLE__)
+
+    if(shouldUseHugePages)
+        return -1;
+
+    // Without memfd we create a uniquely named
+    // shared memory object and unlink it right
+    // away, so only its descriptor refers to it
+
+    static std::atomic<std::uint64_t> numberOfMemoryFiles{0};
+
+    std::string nameOfMemoryFile = "/blMirroredMemory_" +
+                                   std::to_string(getpid()) + "_" +
+                                   std::to_string(numberOfMemoryFiles.fetch_add(1));
+
+    int fileDescriptor = shm_open(nameOfMemoryFile.c_str(),O_CREAT | O_EXCL | O_RDWR,0600);
+
+    if(fileDescriptor >= 0)
+        shm_unlink(nameOfMemoryFile.c_str());
+
+    return fileDescriptor;
+
+#else
+
+    return -1;
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_MIRROREDMEMORY_HPP
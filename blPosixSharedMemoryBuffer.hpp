@@ -0,0 +1,1177 @@
+#ifndef BL_POSIXSHAREDMEMORYBUFFER_HPP
+#define BL_POSIXSHAREDMEMORYBUFFER_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blPosixSharedMemoryBuffer.hpp
+// CLASS:           blPosixSharedMemoryBuffer
+// BASE CLASS:      blBuffer
+//
+//
+//
+// PURPOSE:         -- Specialized template of blBuffer that places its
+//                     data and its control block in a shared memory
+//                     segment created directly with shm_open (or with
+//                     memfd_create for anonymous segments on linux) and
+//                     mapped with mmap, without boost::interprocess
+//
+//                  -- The segment starts with a fixed header describing
+//                     the buffer (data type size, dimensional sizes and
+//                     the offsets of the control block and of the data),
+//                     followed by the control block and then the data,
+//                     so attaching to an existing buffer is a single mmap
+//                     and the data pointer is a plain raw pointer
+//
+//                  -- The creator publishes the header's magic number
+//                     last, so a process attaching while the buffer is
+//                     still being created waits (a bounded amount of
+//                     time) until the buffer is ready
+//
+//                  -- With the MIRRORED allocation mode the data part of
+//                     the segment is mapped twice back to back, as long as
+//                     it's a whole number of pages (each process chooses
+//                     for itself when it creates or attaches)
+//
+//                  -- The segment can be backed by huge pages (see the
+//                     buffer's setPageType function):
+//
+//                     -- Explicit huge pages come from memfd_create with
+//                        MFD_HUGETLB for anonymous segments, and from a
+//                        file in the hugetlbfs mount point for named ones
+//                        (BL_HUGETLBFS_MOUNT_POINT, "/dev/hugepages" by
+//                        default)
+//
+//                     -- Transparent huge pages are asked for with madvise,
+//                        which needs the kernel's shmem_enabled setting to
+//                        allow them
+//
+//                     -- The buffer falls back to the next type of pages
+//                        when the requested one is not available and
+//                        sizeOfPages() reports what backs the data
+//
+//                  -- Reader ids are shared by all processes, so each
+//                     reader process should use its own ids
+//
+//                  -- Since processes exchange the data as raw bytes,
+//                     the data type has to be trivially copyable
+//
+//                  -- The specialized template is defined within the
+//                     blBufferLIB namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- blBuffer and all its dependencies
+//                  -- POSIX shared memory (shm_open, mmap), which
+//                     needs linking with -lrt on older glibc
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+// Include the buffer class
+
+#include "blBuffer.hpp"
+
+
+
+// Used to map the data
+// part twice when mirrored
+
+#include "blMirroredMemory.hpp"
+
+
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <string>
+#include <new>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cerrno>
+#include <type_traits>
+
+
+
+// Used to create, size
+// and map the segments
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+
+#endif
+
+
+
+// The directory where hugetlbfs is
+// mounted, used for named segments
+// backed by explicit huge pages
+
+#ifndef BL_HUGETLBFS_MOUNT_POINT
+#define BL_HUGETLBFS_MOUNT_POINT "/dev/hugepages"
+#endif
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This specialized template is defined within
+//       the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+#if defined(__unix__) || defined(__APPLE__)
+
+
+
+//-------------------------------------------------------------------
+// Specialized template of buffer that works
+// with POSIX shared memory
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+class blPosixSharedMemoryBuffer : public blBuffer<blDataType,blMaxNumOfDimensions>
+{
+    static_assert(std::is_trivially_copyable<blDataType>::value,
+                  "blPosixSharedMemoryBuffer needs a trivially copyable data type");
+
+public: // Public type aliases
+
+
+
+    // The fixed header found at the
+    // beginning of every segment
+    //
+    // -- The magic number is stored last
+    //    (with release semantics) by the
+    //    creator, once everything else in
+    //    the segment has been initialized
+
+    struct header
+    {
+        std::atomic<std::uint64_t>                                          m_magicNumber;
+        std::uint32_t                                                       m_version;
+        std::uint32_t                                                       m_sizeOfDataType;
+        std::uint64_t                                                       m_maxNumberOfDimensions;
+        std::uint64_t                                                       m_sizes[blMaxNumOfDimensions];
+        std::uint64_t                                                       m_pitchAlignments[blMaxNumOfDimensions];
+        std::uint64_t                                                       m_controlBlockOffset;
+        std::uint64_t                                                       m_dataOffset;
+        std::uint64_t                                                       m_sizeOfSegment;
+    };
+
+
+
+    // The header's magic number ("blBufShm")
+    // and layout version
+
+    static constexpr std::uint64_t                                          magicNumber = 0x6d6853667542626cULL;
+    static constexpr std::uint32_t                                          version = 2;
+
+
+
+public: // Constructors and destructors
+
+
+
+    // Default constructor
+
+    blPosixSharedMemoryBuffer();
+
+
+
+    // The buffer owns its mapping,
+    // so it cannot be copied
+
+    blPosixSharedMemoryBuffer(const blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>& sharedMemoryBuffer) = delete;
+
+
+
+    // Destructor (unmaps the segment
+    // but does not remove it)
+
+    ~blPosixSharedMemoryBuffer();
+
+
+
+public: // Assignment operators
+
+
+
+    blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>&             operator=(const blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>& sharedMemoryBuffer) = delete;
+
+
+
+public: // Overloaded Create functions used to
+        // allocate the buffer memory in a shared
+        // memory segment
+
+
+
+    // -- The following functions create a
+    //    named segment big enough for the
+    //    header, the control block and a
+    //    buffer of the specified sizes,
+    //    and map it
+    //
+    // -- The name follows the shm_open rules,
+    //    that is something like "/myBuffer"
+    //
+    // -- If a segment with that name already
+    //    exists, the buffer attaches to it
+    //    instead, taking its sizes from the
+    //    segment's header
+    //
+    // -- An empty name creates an anonymous
+    //    segment (memfd_create, linux only)
+    //    that other processes can attach
+    //    to through its file descriptor,
+    //    either inherited with fork or
+    //    passed over a unix socket
+    //
+    // -- These functions return false if
+    //    the segment could not be created
+    //    nor attached to
+
+    template<typename...blIntegerType>
+    bool                                                                    create(const std::string& nameOfSegment,
+                                                                                   const blIntegerType&... bufferLengths);
+
+    template<typename blIntegerType>
+    bool                                                                    create(const std::string& nameOfSegment,
+                                                                                   const std::initializer_list<blIntegerType>& bufferLengths);
+
+    template<typename blIntegerType>
+    bool                                                                    create(const std::string& nameOfSegment,
+                                                                                   const std::vector<blIntegerType>& bufferLengths);
+
+    template<typename blIntegerType,
+             std::size_t blNumberOfDimensions>
+    bool                                                                    create(const std::string& nameOfSegment,
+                                                                                   const std::array<blIntegerType,blNumberOfDimensions>& bufferLengths);
+
+
+
+public: // Public functions
+
+
+
+    // Functions used to attach to a
+    // segment created by another buffer,
+    // either by its name or by a file
+    // descriptor referring to it
+    //
+    // -- The file descriptor is duplicated,
+    //    so the caller keeps ownership of
+    //    the one passed in
+    //
+    // -- They return false if the segment
+    //    does not exist, does not become
+    //    ready in time or was created for
+    //    a different type of buffer
+
+    bool                                                                    attach(const std::string& nameOfSegment);
+    bool                                                                    attach(const int& fileDescriptor);
+
+
+
+    // Function used to unmap the segment
+    // and go back to an empty buffer
+    //
+    // NOTE: The segment itself lives on
+    //       until it's removed and every
+    //       process has unmapped it
+
+    void                                                                    close();
+
+
+
+    // Function used to remove a named
+    // segment from the system (whether
+    // in shared memory or in hugetlbfs)
+
+    static bool                                                             remove(const std::string& nameOfSegment);
+
+
+
+    // Functions used to query
+    // the mapped segment
+
+    bool                                                                    isAttached()const;
+    int                                                                     fileDescriptor()const;
+    const std::string&                                                      nameOfSegment()const;
+    std::size_t                                                             sizeOfSegment()const;
+
+
+
+private: // Private functions
+
+
+
+    // Create function that does the
+    // actual work of creating the segment
+    // and gets called by the other create
+    // functions
+
+    bool                                                                    create(const std::string& nameOfSegment);
+
+
+
+    // Function used to compute the
+    // segment layout for the current
+    // dimensional sizes
+
+    void                                                                    calculateLayout(std::uint64_t& controlBlockOffset,
+                                                                                            std::uint64_t& dataOffset,
+                                                                                            std::uint64_t& sizeOfSegment)const;
+
+
+
+    // Function used to map the segment,
+    // mirroring its data part if the
+    // buffer's allocation mode asks for it
+    // and the data part is a whole number
+    // of pages, and advising the kernel to
+    // use transparent huge pages if the
+    // buffer asks for them
+
+    bool                                                                    mapSegment(const std::size_t& sizeOfSegment,
+                                                                                       const std::size_t& dataOffset,
+                                                                                       const std::size_t& sizeOfData);
+
+
+
+    // Functions used to find out the size
+    // of the pages of the segment's file and
+    // to get the path of a named segment
+    // backed by explicit huge pages
+
+    void                                                                    findSizeOfFilePages();
+
+    static std::string                                                      pathOfHugePagesFile(const std::string& nameOfSegment);
+
+
+
+    // Function used to remove the segment
+    // we just failed to create
+
+    void                                                                    unlinkSegment();
+
+
+
+    // Function used to map the segment
+    // referred to by m_fileDescriptor,
+    // wait for its header to be ready,
+    // validate it and wrap its data
+
+    bool                                                                    mapExistingSegment();
+
+
+
+    // Function used to wrap the data
+    // and the control block of the
+    // currently mapped segment
+
+    void                                                                    wrapSegment();
+
+
+
+private: // Private variables
+
+
+
+    // The segment's file descriptor,
+    // name and mapping
+
+    int                                                                     m_fileDescriptor;
+    std::string                                                             m_nameOfSegment;
+
+    void*                                                                   m_segment;
+    std::size_t                                                             m_sizeOfSegment;
+
+
+
+    // Where the data part starts when
+    // the segment is mapped mirrored
+    // (zero when it's not)
+
+    std::size_t                                                             m_offsetOfMirroredData;
+
+
+
+    // The size of the pages of the segment's
+    // file (huge pages for hugetlbfs files),
+    // the size of the pages backing the data
+    // and whether the named segment lives
+    // in hugetlbfs
+
+    std::size_t                                                             m_sizeOfFilePages;
+    std::size_t                                                             m_sizeOfDataPages;
+
+    bool                                                                    m_isSegmentInHugePagesFileSystem;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Default constructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::blPosixSharedMemoryBuffer() : blBuffer<blDataType,blMaxNumOfDimensions>()
+{
+    // The buffer starts out
+    // without any segment
+
+    m_fileDescriptor = -1;
+
+    m_segment = nullptr;
+    m_sizeOfSegment = 0;
+    m_offsetOfMirroredData = 0;
+
+    m_sizeOfFilePages = 0;
+    m_sizeOfDataPages = 0;
+
+    m_isSegmentInHugePagesFileSystem = false;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::~blPosixSharedMemoryBuffer()
+{
+    close();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// create functions used to allocate and
+// initialize space for the buffer
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+template<typename...blIntegerType>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::create(const std::string& nameOfSegment,
+                                                                               const blIntegerType&...bufferLengths)
+{
+    close();
+
+    this->m_properties.setDimensionalSizes(bufferLengths...);
+
+    return create(nameOfSegment);
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+template<typename blIntegerType>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::create(const std::string& nameOfSegment,
+                                                                               const std::initializer_list<blIntegerType>& bufferLengths)
+{
+    close();
+
+    this->m_properties.setDimensionalSizes(bufferLengths);
+
+    return create(nameOfSegment);
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+template<typename blIntegerType>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::create(const std::string& nameOfSegment,
+                                                                               const std::vector<blIntegerType>& bufferLengths)
+{
+    close();
+
+    this->m_properties.setDimensionalSizes(bufferLengths);
+
+    return create(nameOfSegment);
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+template<typename blIntegerType,
+         std::size_t blNumberOfDimensions>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::create(const std::string& nameOfSegment,
+                                                                               const std::array<blIntegerType,blNumberOfDimensions>& bufferLengths)
+{
+    close();
+
+    this->m_properties.setDimensionalSizes(bufferLengths);
+
+    return create(nameOfSegment);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// create function used to create the segment
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::create(const std::string& nameOfSegment)
+{
+    this->applyPitchAlignments();
+
+    if(this->size() == 0)
+        return false;
+
+
+
+    // First we create the segment, making
+    // sure we are the ones creating it, out
+    // of explicit huge pages if asked to
+
+    bool shouldUseHugePages = (this->pageType() == blPageType::HUGE);
+
+    if(nameOfSegment.empty())
+    {
+#ifdef __linux__
+#ifdef MFD_HUGETLB
+        if(shouldUseHugePages)
+            m_fileDescriptor = memfd_create("blPosixSharedMemoryBuffer",MFD_CLOEXEC | MFD_HUGETLB);
+#endif
+
+        if(m_fileDescriptor < 0)
+            m_fileDescriptor = memfd_create("blPosixSharedMemoryBuffer",MFD_CLOEXEC);
+#endif
+
+        if(m_fileDescriptor < 0)
+            return false;
+    }
+    else
+    {
+        if(shouldUseHugePages)
+        {
+            m_fileDescriptor = ::open(pathOfHugePagesFile(nameOfSegment).c_str(),O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC,0600);
+
+            if(m_fileDescriptor < 0 && errno == EEXIST)
+                return attach(nameOfSegment);
+
+            m_isSegmentInHugePagesFileSystem = (m_fileDescriptor >= 0);
+        }
+
+        if(m_fileDescriptor < 0)
+            m_fileDescriptor = shm_open(nameOfSegment.c_str(),O_CREAT | O_EXCL | O_RDWR,0600);
+
+        if(m_fileDescriptor < 0)
+        {
+            // If somebody else already created
+            // it, we attach to theirs
+
+            if(errno == EEXIST)
+                return attach(nameOfSegment);
+
+            return false;
+        }
+    }
+
+    m_nameOfSegment = nameOfSegment;
+
+    findSizeOfFilePages();
+
+
+
+    // We then size and map it, the
+    // new pages all read as zero
+
+    std::uint64_t controlBlockOffset = 0;
+    std::uint64_t dataOffset = 0;
+    std::uint64_t sizeOfSegment = 0;
+
+    calculateLayout(controlBlockOffset,dataOffset,sizeOfSegment);
+
+    if(ftruncate(m_fileDescriptor,static_cast<off_t>(sizeOfSegment)) != 0 ||
+       !mapSegment(sizeOfSegment,dataOffset,this->size() * sizeof(blDataType)))
+    {
+        unlinkSegment();
+        close();
+        return false;
+    }
+
+
+
+    // Then we construct the control block
+    // and fill in the header, publishing
+    // its magic number last so that nobody
+    // attaches to a half built buffer
+
+    char* segment = static_cast<char*>(m_segment);
+
+    new(segment + controlBlockOffset) blRingControlBlock();
+
+    header* segmentHeader = new(segment) header();
+
+    segmentHeader->m_version = version;
+    segmentHeader->m_sizeOfDataType = static_cast<std::uint32_t>(sizeof(blDataType));
+    segmentHeader->m_maxNumberOfDimensions = blMaxNumOfDimensions;
+
+    for(std::size_t i = 0; i < blMaxNumOfDimensions; ++i)
+    {
+        segmentHeader->m_sizes[i] = this->m_properties.sizes()[i];
+        segmentHeader->m_pitchAlignments[i] = this->m_properties.pitchAlignment(i);
+    }
+
+    segmentHeader->m_controlBlockOffset = controlBlockOffset;
+    segmentHeader->m_dataOffset = dataOffset;
+    segmentHeader->m_sizeOfSegment = sizeOfSegment;
+
+    segmentHeader->m_magicNumber.store(magicNumber,std::memory_order_release);
+
+
+
+    // Finally we wrap the data
+    // and the control block, and
+    // prefault it if asked to (without
+    // writing to it, since other processes
+    // can already attach to the segment)
+
+    wrapSegment();
+
+    this->prefaultAndLockData(false);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to attach to an existing segment
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::attach(const std::string& nameOfSegment)
+{
+    close();
+
+    // The segment is either in shared
+    // memory or, if it's backed by explicit
+    // huge pages, in hugetlbfs
+
+    m_fileDescriptor = shm_open(nameOfSegment.c_str(),O_RDWR,0600);
+
+    if(m_fileDescriptor < 0)
+    {
+        m_fileDescriptor = ::open(pathOfHugePagesFile(nameOfSegment).c_str(),O_RDWR | O_CLOEXEC);
+
+        if(m_fileDescriptor < 0)
+            return false;
+
+        m_isSegmentInHugePagesFileSystem = true;
+    }
+
+    m_nameOfSegment = nameOfSegment;
+
+    return mapExistingSegment();
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::attach(const int& fileDescriptor)
+{
+    close();
+
+    m_fileDescriptor = fcntl(fileDescriptor,F_DUPFD_CLOEXEC,0);
+
+    if(m_fileDescriptor < 0)
+        return false;
+
+    return mapExistingSegment();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to map and validate an existing segment
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::mapExistingSegment()
+{
+    // The creator sizes the segment right
+    // after creating it and publishes the
+    // header last, so we give it a second
+    // to get there
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+    struct stat segmentStatus;
+
+    while(true)
+    {
+        if(fstat(m_fileDescriptor,&segmentStatus) != 0)
+        {
+            close();
+            return false;
+        }
+
+        if(static_cast<std::size_t>(segmentStatus.st_size) >= sizeof(header))
+            break;
+
+        if(std::chrono::steady_clock::now() >= deadline)
+        {
+            close();
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+
+
+    // The whole segment is
+    // mapped with a single mmap
+
+    findSizeOfFilePages();
+
+    m_sizeOfSegment = static_cast<std::size_t>(segmentStatus.st_size);
+
+    m_segment = mmap(nullptr,m_sizeOfSegment,PROT_READ | PROT_WRITE,MAP_SHARED,m_fileDescriptor,0);
+
+    if(m_segment == MAP_FAILED)
+    {
+        m_segment = nullptr;
+        close();
+        return false;
+    }
+
+    m_sizeOfDataPages = m_sizeOfFilePages;
+
+    const header* segmentHeader = static_cast<const header*>(m_segment);
+
+    while(segmentHeader->m_magicNumber.load(std::memory_order_acquire) != magicNumber)
+    {
+        if(std::chrono::steady_clock::now() >= deadline)
+        {
+            close();
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+
+
+    // Then we make sure the segment
+    // holds the same type of buffer
+
+    if(segmentHeader->m_version != version ||
+       segmentHeader->m_sizeOfDataType != sizeof(blDataType) ||
+       segmentHeader->m_maxNumberOfDimensions != blMaxNumOfDimensions ||
+       segmentHeader->m_sizeOfSegment > m_sizeOfSegment)
+    {
+        close();
+        return false;
+    }
+
+
+
+    // Finally we take the sizes (and
+    // padding) from the header and wrap
+    // the segment
+
+    std::array<std::uint64_t,blMaxNumOfDimensions> sizes;
+
+    for(std::size_t i = 0; i < blMaxNumOfDimensions; ++i)
+    {
+        sizes[i] = segmentHeader->m_sizes[i];
+        this->m_properties.setPitchAlignment(i,segmentHeader->m_pitchAlignments[i]);
+    }
+
+    this->m_properties.setDimensionalSizes(sizes);
+
+
+
+    // A mirrored buffer (or one asking for
+    // transparent huge pages) maps the
+    // segment once more, this time with
+    // its data part mirrored (or advised)
+
+    if(this->allocationMode() == blAllocationMode::MIRRORED ||
+       this->pageType() != blPageType::REGULAR)
+    {
+        std::size_t sizeOfSegment = static_cast<std::size_t>(segmentHeader->m_sizeOfSegment);
+        std::size_t dataOffset = static_cast<std::size_t>(segmentHeader->m_dataOffset);
+
+        munmap(m_segment,m_sizeOfSegment);
+        m_segment = nullptr;
+
+        if(!mapSegment(sizeOfSegment,dataOffset,this->size() * sizeof(blDataType)))
+        {
+            close();
+            return false;
+        }
+    }
+
+    wrapSegment();
+
+    this->prefaultAndLockData(false);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to wrap the mapped segment
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline void blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::wrapSegment()
+{
+    char* segment = static_cast<char*>(m_segment);
+    const header* segmentHeader = static_cast<const header*>(m_segment);
+
+    this->wrap(reinterpret_cast<blDataType*>(segment + segmentHeader->m_dataOffset));
+
+    this->m_isMirrored = (m_offsetOfMirroredData != 0);
+    this->m_sizeOfPages = m_sizeOfDataPages;
+
+    this->setControlBlock(reinterpret_cast<blRingControlBlock*>(segment + segmentHeader->m_controlBlockOffset));
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to compute the segment layout
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline void blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::calculateLayout(std::uint64_t& controlBlockOffset,
+                                                                                        std::uint64_t& dataOffset,
+                                                                                        std::uint64_t& sizeOfSegment)const
+{
+    // The header comes first, then the
+    // control block and then the data,
+    // each starting on its own cache line
+    // (the data on its own page when the
+    // buffer could be mirrored), and the
+    // segment is a whole number of the
+    // file's pages
+
+    auto roundUp = [](const std::uint64_t& value,const std::uint64_t& alignment)
+    {
+        return ((value + alignment - 1) / alignment) * alignment;
+    };
+
+    std::uint64_t alignmentOfData = std::max<std::uint64_t>(blCacheLineSize,alignof(blDataType));
+
+    if(this->allocationMode() == blAllocationMode::MIRRORED)
+        alignmentOfData = std::max<std::uint64_t>(alignmentOfData,m_sizeOfFilePages);
+
+    controlBlockOffset = roundUp(sizeof(header),alignof(blRingControlBlock));
+    dataOffset = roundUp(controlBlockOffset + sizeof(blRingControlBlock),alignmentOfData);
+    sizeOfSegment = roundUp(dataOffset + this->size() * sizeof(blDataType),m_sizeOfFilePages);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to map the segment
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::mapSegment(const std::size_t& sizeOfSegment,
+                                                                                   const std::size_t& dataOffset,
+                                                                                   const std::size_t& sizeOfData)
+{
+    // We first try to mirror the
+    // data part if we're asked to
+
+    m_offsetOfMirroredData = 0;
+
+    if(this->allocationMode() == blAllocationMode::MIRRORED && dataOffset > 0)
+    {
+        m_segment = blMirroredMemory::mapMirrored(m_fileDescriptor,
+                                                  dataOffset,
+                                                  sizeOfData,
+                                                  m_sizeOfFilePages);
+
+        if(m_segment != nullptr)
+        {
+            m_sizeOfSegment = dataOffset + sizeOfData;
+            m_offsetOfMirroredData = dataOffset;
+        }
+    }
+
+
+
+    // Otherwise we map it
+    // in one regular piece
+
+    if(m_segment == nullptr)
+    {
+        m_segment = mmap(nullptr,sizeOfSegment,PROT_READ | PROT_WRITE,MAP_SHARED,m_fileDescriptor,0);
+
+        if(m_segment == MAP_FAILED)
+        {
+            m_segment = nullptr;
+            return false;
+        }
+
+        m_sizeOfSegment = sizeOfSegment;
+    }
+
+
+
+    // Regular pages can still be
+    // promoted to transparent huge
+    // pages if the buffer asks for it
+
+    m_sizeOfDataPages = m_sizeOfFilePages;
+
+    if(this->pageType() != blPageType::REGULAR && m_sizeOfFilePages == blMappedMemory::pageSize())
+    {
+        char* data = static_cast<char*>(m_segment) + dataOffset;
+
+        m_sizeOfDataPages = blMappedMemory::adviseTransparentHugePages(data,sizeOfData,true);
+
+        if(m_offsetOfMirroredData != 0)
+            blMappedMemory::adviseTransparentHugePages(data + sizeOfData,sizeOfData,true);
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to deal with the segment's file
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline void blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::findSizeOfFilePages()
+{
+    // The block size of a hugetlbfs
+    // file (or MFD_HUGETLB memfd) is
+    // the size of its huge pages
+
+    struct statvfs fileSystemStatus;
+
+    m_sizeOfFilePages = blMappedMemory::pageSize();
+
+    if(fstatvfs(m_fileDescriptor,&fileSystemStatus) == 0 &&
+       fileSystemStatus.f_bsize > m_sizeOfFilePages &&
+       fileSystemStatus.f_bsize % m_sizeOfFilePages == 0)
+    {
+        m_sizeOfFilePages = static_cast<std::size_t>(fileSystemStatus.f_bsize);
+    }
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline std::string blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::pathOfHugePagesFile(const std::string& nameOfSegment)
+{
+    // Segment names start with a slash
+
+    if(!nameOfSegment.empty() && nameOfSegment.front() == '/')
+        return std::string(BL_HUGETLBFS_MOUNT_POINT) + nameOfSegment;
+
+    return std::string(BL_HUGETLBFS_MOUNT_POINT) + "/" + nameOfSegment;
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline void blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::unlinkSegment()
+{
+    if(m_nameOfSegment.empty())
+        return;
+
+    if(m_isSegmentInHugePagesFileSystem)
+        ::unlink(pathOfHugePagesFile(m_nameOfSegment).c_str());
+    else
+        shm_unlink(m_nameOfSegment.c_str());
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to unmap the segment
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline void blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::close()
+{
+    // We first stop pointing at the
+    // segment's data and control block
+
+    if(m_segment != nullptr)
+    {
+        this->unlockData();
+
+        this->m_properties.setDimensionalSizes();
+        this->resetDataPointers();
+        this->setControlBlock(nullptr);
+
+        if(m_offsetOfMirroredData != 0)
+            blMirroredMemory::unmapMirrored(m_segment,m_offsetOfMirroredData,m_sizeOfSegment - m_offsetOfMirroredData);
+        else
+            munmap(m_segment,m_sizeOfSegment);
+    }
+
+    m_segment = nullptr;
+    m_sizeOfSegment = 0;
+    m_offsetOfMirroredData = 0;
+
+    m_sizeOfFilePages = 0;
+    m_sizeOfDataPages = 0;
+
+
+
+    // Then we close the segment
+
+    if(m_fileDescriptor >= 0)
+        ::close(m_fileDescriptor);
+
+    m_fileDescriptor = -1;
+    m_nameOfSegment.clear();
+    m_isSegmentInHugePagesFileSystem = false;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to remove a named segment
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::remove(const std::string& nameOfSegment)
+{
+    if(shm_unlink(nameOfSegment.c_str()) == 0)
+        return true;
+
+    return ::unlink(pathOfHugePagesFile(nameOfSegment).c_str()) == 0;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to query the mapped segment
+//-------------------------------------------------------------------
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline bool blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::isAttached()const
+{
+    return m_segment != nullptr;
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline int blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::fileDescriptor()const
+{
+    return m_fileDescriptor;
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline const std::string& blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::nameOfSegment()const
+{
+    return m_nameOfSegment;
+}
+
+
+
+template<typename blDataType,
+         std::size_t blMaxNumOfDimensions>
+
+inline std::size_t blPosixSharedMemoryBuffer<blDataType,blMaxNumOfDimensions>::sizeOfSegment()const
+{
+    return m_sizeOfSegment;
+}
+//-------------------------------------------------------------------
+
+
+
+#endif
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_POSIXSHAREDMEMORYBUFFER_HPP
@@ -0,0 +1,636 @@
+#ifndef BL_READERREGISTRY_HPP
+#define BL_READERREGISTRY_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blReaderRegistry.hpp
+// CLASS:           blReaderRegistry
+//                  blReaderSlot
+//                  blReaderHandle
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         -- The blReaderRegistry class is a fixed capacity
+//                     array of reader slots, where each slot holds the
+//                     read cursor (the sequence of the next data point
+//                     to read) of one reader of a buffer
+//
+//                  -- Each slot is padded to its own cache line, so
+//                     that readers advancing their own cursors don't
+//                     slow each other down (false sharing)
+//
+//                  -- Readers register once and get back a handle,
+//                     which gives them O(1) access to their slot
+//
+//                  -- Looking a reader up by its id scans the slots
+//                     starting from the one the id hashes to, which is
+//                     also the first slot the reader tries to claim, so
+//                     the lookup usually ends at the first slot, but
+//                     readers on a hot path should still keep their
+//                     handle rather than their id
+//
+//                  -- Registering and deregistering readers is lock-free,
+//                     slots are claimed with a compare-and-swap and are
+//                     reused once their reader deregisters, when two
+//                     threads register the same id at once, only one
+//                     of them keeps its slot
+//
+//                  -- Each slot also keeps the reader's lap and loss
+//                     statistics, which can be read lock-free by any
+//                     thread
+//
+//                  -- Each slot keeps a generation count that is bumped
+//                     every time the slot is released, so a stale handle
+//                     to a reused slot is detected as invalid
+//
+//                  -- The maximum number of readers defaults to 64 and
+//                     can be changed by defining BL_BUFFER_MAX_NUMBER_OF_READERS
+//                     before including the library
+//
+//                  -- These classes are defined within the namespace "blBufferLIB"
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- C++17
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The default maximum number of readers
+// that can be registered with a buffer
+//-------------------------------------------------------------------
+#ifndef BL_BUFFER_MAX_NUMBER_OF_READERS
+#define BL_BUFFER_MAX_NUMBER_OF_READERS 64
+#endif
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The cache line size used to pad reader slots
+//-------------------------------------------------------------------
+constexpr std::size_t blCacheLineSize = 64;
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// A handle to a registered reader, which is just
+// the index of its slot and the slot's generation
+// at the time the reader registered
+//-------------------------------------------------------------------
+class blReaderHandle
+{
+public: // Public functions
+
+
+
+    // Function used to check whether
+    // the handle refers to a slot at all
+    // (registering fails when the registry
+    // is full)
+
+    bool                                                    isValid()const{return m_slotIndex != invalidSlotIndex;}
+
+
+
+public: // Public variables
+
+
+
+    static constexpr std::size_t                            invalidSlotIndex = std::size_t(-1);
+
+    std::size_t                                             m_slotIndex = invalidSlotIndex;
+    std::uint32_t                                           m_generation = 0;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// A reader slot, padded to its own cache line
+//-------------------------------------------------------------------
+struct alignas(blCacheLineSize) blReaderSlot
+{
+    // The possible slot states
+
+    static constexpr std::uint32_t                          FREE = 0;
+    static constexpr std::uint32_t                          CLAIMED = 1;
+    static constexpr std::uint32_t                          ACTIVE = 2;
+    static constexpr std::uint32_t                          REGISTERING = 3;
+
+
+
+    // The slot state, the id of the
+    // reader using it and the slot's
+    // generation count
+
+    std::atomic<std::uint32_t>                              m_state{FREE};
+    std::atomic<std::uint32_t>                              m_generation{0};
+    std::atomic<int>                                        m_id{0};
+
+
+
+    // The reader's cursor, that is the
+    // sequence of the next data point
+    // the reader is going to read
+
+    std::atomic<std::uint64_t>                              m_cursor{0};
+
+
+
+    // The reader's statistics, only ever
+    // written by the reader itself, so
+    // they're plain stores that can be
+    // read at any time by another thread
+    // (for example a monitoring thread)
+    //
+    // -- The number of data points the
+    //    reader skipped because the writer
+    //    lapped it, and how many times
+    //    that happened
+    //
+    // -- The largest number of data points
+    //    the reader has been behind the
+    //    writer
+
+    std::atomic<std::uint64_t>                              m_numberOfElementsLost{0};
+    std::atomic<std::uint64_t>                              m_numberOfLaps{0};
+    std::atomic<std::uint64_t>                              m_peakLag{0};
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// A snapshot of a reader's statistics
+//-------------------------------------------------------------------
+struct blReaderStatistics
+{
+    std::uint64_t                                           m_numberOfElementsLost = 0;
+    std::uint64_t                                           m_numberOfLaps = 0;
+
+    std::uint64_t                                           m_lagInElements = 0;
+    std::uint64_t                                           m_lagInBytes = 0;
+    std::uint64_t                                           m_peakLagInElements = 0;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blReaderRegistry declaration
+//-------------------------------------------------------------------
+template<std::size_t blMaxNumberOfReaders>
+
+class blReaderRegistry
+{
+public: // Constructors and destructors
+
+
+
+    // Default constructor
+
+    blReaderRegistry();
+
+
+
+    // Destructor
+
+    ~blReaderRegistry();
+
+
+
+public: // Public functions
+
+
+
+    // Function used to get the maximum
+    // number of readers in the registry
+
+    static constexpr std::size_t                            capacity(){return blMaxNumberOfReaders;}
+
+
+
+    // This function registers a reader with
+    // the specified id and starting cursor,
+    // or returns the handle of the active
+    // reader that already uses that id
+    //
+    // The returned handle is invalid if
+    // the registry is full
+
+    blReaderHandle                                          registerReader(const int& id,
+                                                                           const std::uint64_t& startingCursor);
+
+
+
+    // This function deregisters the
+    // reader, making its slot available
+    // for other readers
+    //
+    // It returns false if the handle
+    // was stale or invalid
+
+    bool                                                    deregisterReader(const blReaderHandle& handle);
+
+
+
+    // This function returns the handle
+    // of the active reader with the
+    // specified id, or an invalid handle
+    // if there's no such reader
+
+    blReaderHandle                                          findReader(const int& id)const;
+
+
+
+    // This function returns the slot
+    // referred to by a handle, or a
+    // null pointer if the handle is
+    // invalid or stale
+
+    blReaderSlot*                                           slot(const blReaderHandle& handle);
+    const blReaderSlot*                                     slot(const blReaderHandle& handle)const;
+
+
+
+    // This function calls the specified
+    // function for every active reader slot
+
+    template<typename blFunctionType>
+    void                                                    forEachActiveReader(blFunctionType function)const;
+
+
+
+protected: // Protected functions
+
+
+
+    // Function used to get the slot
+    // an id hashes to, which is where
+    // the scans for that id start
+
+    static std::size_t                                      firstSlotIndex(const int& id);
+
+
+
+    // Function used by a registering
+    // reader, whose id is already visible
+    // in its slot, to find out whether
+    // another reader with the same id
+    // wins instead (an active one, or a
+    // registering one in a lower slot)
+
+    bool                                                    isIdTakenByAnotherSlot(const std::size_t& slotIndex,
+                                                                                   const int& id)const;
+
+
+
+protected: // Protected variables
+
+
+
+    // The reader slots
+
+    std::array<blReaderSlot,blMaxNumberOfReaders>           m_slots;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Default constructor
+//-------------------------------------------------------------------
+template<std::size_t blMaxNumberOfReaders>
+
+inline blReaderRegistry<blMaxNumberOfReaders>::blReaderRegistry()
+{
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+template<std::size_t blMaxNumberOfReaders>
+
+inline blReaderRegistry<blMaxNumberOfReaders>::~blReaderRegistry()
+{
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to register/deregister readers
+//-------------------------------------------------------------------
+template<std::size_t blMaxNumberOfReaders>
+
+inline blReaderHandle blReaderRegistry<blMaxNumberOfReaders>::registerReader(const int& id,
+                                                                             const std::uint64_t& startingCursor)
+{
+    while(true)
+    {
+        // If a reader with this id is
+        // already active we just hand
+        // out its handle
+
+        blReaderHandle handle = findReader(id);
+
+        if(handle.isValid())
+            return handle;
+
+
+
+        // Otherwise we claim the first
+        // free slot we find
+
+        std::size_t claimedSlotIndex = blReaderHandle::invalidSlotIndex;
+
+        for(std::size_t j = 0, i = firstSlotIndex(id); j < blMaxNumberOfReaders; ++j, i = (i + 1) % blMaxNumberOfReaders)
+        {
+            std::uint32_t expectedState = blReaderSlot::FREE;
+
+            if(m_slots[i].m_state.load(std::memory_order_relaxed) == blReaderSlot::FREE &&
+               m_slots[i].m_state.compare_exchange_strong(expectedState,
+                                                          blReaderSlot::CLAIMED,
+                                                          std::memory_order_acquire))
+            {
+                claimedSlotIndex = i;
+                break;
+            }
+        }
+
+        if(claimedSlotIndex == blReaderHandle::invalidSlotIndex)
+        {
+            // The registry is full
+
+            return blReaderHandle();
+        }
+
+
+
+        // Another thread might be registering
+        // the same id right now, so we first
+        // make our id visible (the sequentially
+        // consistent store and loads make sure
+        // that at least one of two such threads
+        // sees the other) and back off if the
+        // other reader wins
+
+        blReaderSlot& readerSlot = m_slots[claimedSlotIndex];
+
+        readerSlot.m_id.store(id,std::memory_order_relaxed);
+
+        readerSlot.m_state.store(blReaderSlot::REGISTERING,std::memory_order_seq_cst);
+
+        if(isIdTakenByAnotherSlot(claimedSlotIndex,id))
+        {
+            readerSlot.m_state.store(blReaderSlot::FREE,std::memory_order_release);
+            continue;
+        }
+
+
+
+        // The slot is ours, so we set it
+        // up and then make it active, which
+        // publishes the cursor to everyone
+        // scanning the registry
+
+        readerSlot.m_cursor.store(startingCursor,std::memory_order_relaxed);
+
+        readerSlot.m_numberOfElementsLost.store(0,std::memory_order_relaxed);
+        readerSlot.m_numberOfLaps.store(0,std::memory_order_relaxed);
+        readerSlot.m_peakLag.store(0,std::memory_order_relaxed);
+
+        readerSlot.m_state.store(blReaderSlot::ACTIVE,std::memory_order_release);
+
+        handle.m_slotIndex = claimedSlotIndex;
+        handle.m_generation = readerSlot.m_generation.load(std::memory_order_relaxed);
+
+        return handle;
+    }
+}
+
+
+
+template<std::size_t blMaxNumberOfReaders>
+
+inline bool blReaderRegistry<blMaxNumberOfReaders>::isIdTakenByAnotherSlot(const std::size_t& slotIndex,
+                                                                           const int& id)const
+{
+    for(std::size_t i = 0; i < blMaxNumberOfReaders; ++i)
+    {
+        if(i == slotIndex)
+            continue;
+
+        std::uint32_t state = m_slots[i].m_state.load(std::memory_order_seq_cst);
+
+        if(state != blReaderSlot::ACTIVE && state != blReaderSlot::REGISTERING)
+            continue;
+
+        if(m_slots[i].m_id.load(std::memory_order_relaxed) != id)
+            continue;
+
+        if(state == blReaderSlot::ACTIVE || i < slotIndex)
+            return true;
+
+
+
+        // A registering reader in a higher
+        // slot backs off if it sees us, or
+        // goes on without ever waiting for
+        // us, so we wait for it to decide
+
+        while(state == blReaderSlot::REGISTERING)
+            state = m_slots[i].m_state.load(std::memory_order_seq_cst);
+
+        if(state == blReaderSlot::ACTIVE &&
+           m_slots[i].m_id.load(std::memory_order_relaxed) == id)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+
+template<std::size_t blMaxNumberOfReaders>
+
+inline bool blReaderRegistry<blMaxNumberOfReaders>::deregisterReader(const blReaderHandle& handle)
+{
+    blReaderSlot* readerSlot = slot(handle);
+
+    if(readerSlot == nullptr)
+        return false;
+
+
+
+    // We bump the generation first, so
+    // that the stale handles are detected
+    // before the slot gets reused
+
+    readerSlot->m_generation.fetch_add(1,std::memory_order_relaxed);
+
+    readerSlot->m_state.store(blReaderSlot::FREE,std::memory_order_release);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to find an active reader by its id
+//-------------------------------------------------------------------
+template<std::size_t blMaxNumberOfReaders>
+
+inline blReaderHandle blReaderRegistry<blMaxNumberOfReaders>::findReader(const int& id)const
+{
+    blReaderHandle handle;
+
+    for(std::size_t j = 0, i = firstSlotIndex(id); j < blMaxNumberOfReaders; ++j, i = (i + 1) % blMaxNumberOfReaders)
+    {
+        if(m_slots[i].m_state.load(std::memory_order_acquire) == blReaderSlot::ACTIVE &&
+           m_slots[i].m_id.load(std::memory_order_relaxed) == id)
+        {
+            handle.m_slotIndex = i;
+            handle.m_generation = m_slots[i].m_generation.load(std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    return handle;
+}
+
+
+
+template<std::size_t blMaxNumberOfReaders>
+
+inline std::size_t blReaderRegistry<blMaxNumberOfReaders>::firstSlotIndex(const int& id)
+{
+    return static_cast<std::size_t>(static_cast<unsigned int>(id)) % blMaxNumberOfReaders;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get a hold of the slot referred to by a handle
+//-------------------------------------------------------------------
+template<std::size_t blMaxNumberOfReaders>
+
+inline blReaderSlot* blReaderRegistry<blMaxNumberOfReaders>::slot(const blReaderHandle& handle)
+{
+    if(handle.m_slotIndex >= blMaxNumberOfReaders)
+        return nullptr;
+
+    blReaderSlot& readerSlot = m_slots[handle.m_slotIndex];
+
+    // The state is loaded first, a slot
+    // released and reused after that has
+    // its generation bumped, which the
+    // second check catches
+
+    if(readerSlot.m_state.load(std::memory_order_acquire) != blReaderSlot::ACTIVE ||
+       readerSlot.m_generation.load(std::memory_order_relaxed) != handle.m_generation)
+    {
+        return nullptr;
+    }
+
+    return &readerSlot;
+}
+
+
+
+template<std::size_t blMaxNumberOfReaders>
+
+inline const blReaderSlot* blReaderRegistry<blMaxNumberOfReaders>::slot(const blReaderHandle& handle)const
+{
+    if(handle.m_slotIndex >= blMaxNumberOfReaders)
+        return nullptr;
+
+    const blReaderSlot& readerSlot = m_slots[handle.m_slotIndex];
+
+    // The state is loaded first, a slot
+    // released and reused after that has
+    // its generation bumped, which the
+    // second check catches
+
+    if(readerSlot.m_state.load(std::memory_order_acquire) != blReaderSlot::ACTIVE ||
+       readerSlot.m_generation.load(std::memory_order_relaxed) != handle.m_generation)
+    {
+        return nullptr;
+    }
+
+    return &readerSlot;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to visit every active reader slot
+//-------------------------------------------------------------------
+template<std::size_t blMaxNumberOfReaders>
+
+template<typename blFunctionType>
+
+inline void blReaderRegistry<blMaxNumberOfReaders>::forEachActiveReader(blFunctionType function)const
+{
+    for(std::size_t i = 0; i < blMaxNumberOfReaders; ++i)
+    {
+        if(m_slots[i].m_state.load(std::memory_order_acquire) == blReaderSlot::ACTIVE)
+            function(m_slots[i]);
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_READERREGISTRY_HPP
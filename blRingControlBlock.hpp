@@ -0,0 +1,169 @@
+#ifndef BL_RINGCONTROLBLOCK_HPP
+#define BL_RINGCONTROLBLOCK_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blRingControlBlock.hpp
+// CLASS:           blRingControlBlock
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         -- The blRingControlBlock struct holds all the state
+//                     writers and readers of a circular buffer share,
+//                     that is the published and claimed write sequences,
+//                     the writers flag, the wait strategies (and thus
+//                     the futex words parked threads wait on), the
+//                     readers watermark and the registry of the readers'
+//                     cursors
+//
+//                  -- By default every buffer owns its own control block,
+//                     but a buffer can also point to a control block that
+//                     lives somewhere else, for example in the same shared
+//                     memory segment as the buffer's data, so that threads
+//                     in different processes share one ring
+//
+//                  -- The control block is made of lock-free atomics and
+//                     fixed size arrays only (no pointers), so it can be
+//                     placed in shared memory as is
+//
+//                  -- This struct is defined within the namespace "blBufferLIB"
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- blWaitStrategy
+//                  -- blReaderRegistry
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+
+
+// Used by the threads waiting
+// on the ring and to keep track
+// of the readers' cursors
+
+#include "blWaitStrategy.hpp"
+#include "blReaderRegistry.hpp"
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This struct is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The control block can only be shared between
+// processes if its atomics don't need any locks
+//-------------------------------------------------------------------
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+              std::atomic<std::uint32_t>::is_always_lock_free &&
+              std::atomic<bool>::is_always_lock_free,
+              "blRingControlBlock needs lock-free atomics");
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// struct blRingControlBlock
+//-------------------------------------------------------------------
+struct blRingControlBlock
+{
+    // The registry type used
+    // to store the readers
+
+    using reader_registry = blReaderRegistry<BL_BUFFER_MAX_NUMBER_OF_READERS>;
+
+
+
+    // The published write sequence, stored
+    // with release semantics by the writer
+    // every time it's done writing, kept on
+    // its own cache line since every reader
+    // keeps loading it
+
+    alignas(blCacheLineSize) std::atomic<std::uint64_t>     m_publishedWriteSequence{0};
+
+
+
+    // The claimed write sequence used
+    // by the multiple writers mode and
+    // the flag used by the locked writers
+    // mode to take turns
+
+    alignas(blCacheLineSize) std::atomic<std::uint64_t>     m_claimedWriteSequence{0};
+
+    std::atomic_bool                                        m_isBufferBeingCurrentlyWrittenTo{false};
+
+
+
+    // The overrun policy's cached cursor
+    // of the slowest reader and the number
+    // of dropped writes
+
+    std::atomic<std::uint64_t>                              m_cachedMinimumReaderCursor{0};
+
+    std::atomic<std::uint64_t>                              m_numberOfFailedWrites{0};
+
+
+
+    // The lowest write sequence any of
+    // the parked readers is waiting for
+    // (the maximum value when none is)
+
+    alignas(blCacheLineSize) std::atomic<std::uint64_t>     m_lowestReaderWatermark{std::numeric_limits<std::uint64_t>::max()};
+
+
+
+    // The strategies used by writers
+    // waiting for their turn and by
+    // readers waiting for data
+
+    alignas(blCacheLineSize) blWaitStrategy                 m_writersWaitStrategy;
+
+    alignas(blCacheLineSize) blWaitStrategy                 m_readersWaitStrategy;
+
+
+
+    // The registry holding the
+    // cursors of all the readers
+
+    reader_registry                                         m_readers;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_RINGCONTROLBLOCK_HPP
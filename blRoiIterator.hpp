@@ -24,6 +24,19 @@
 //
 //                        -- const blDataType& roi_at(const blIntegerType& dataIndex)const
 //
+//                        -- std::size_t roiRunLength()const
+//
+//                  -- The ROI is a sequence of contiguous runs (see
+//                     blBuffer_4::roiRunLength), the iterator caches
+//                     a pointer to the run it is in, so moving and
+//                     dereferencing within a run is plain pointer
+//                     arithmetic, and ROI indexes are only decomposed
+//                     when the iterator steps into another run
+//
+//                  -- Like any other iterator, a ROI iterator has to
+//                     be obtained again after the ROI or the buffer
+//                     are changed
+//
 //
 //
 // AUTHOR:          Vincenzo Barbato
@@ -40,7 +53,7 @@
 // DEPENDENCIES:    -- blCircularIterator
 //
 //                  -- The buffer type has to define the above
-//                     mentioned "roi_at" functions
+//                     mentioned "roi_at" and "roiRunLength" functions
 //-------------------------------------------------------------------
 
 
@@ -93,9 +106,13 @@ public: // Constructors and destructors
 
 
 
-    // Copy constructor
+    // Copy constructor and assignment
+    // operator (the cached run is copied
+    // along with the circular state)
 
-    blRoiIterator(const blRoiIterator<blBufferType,blBufferPtr>& roiIterator);
+    blRoiIterator(const blRoiIterator<blBufferType,blBufferPtr>& roiIterator) = default;
+
+    blRoiIterator<blBufferType,blBufferPtr>& operator=(const blRoiIterator<blBufferType,blBufferPtr>& roiIterator) = default;
 
 
 
@@ -148,6 +165,8 @@ public: // Overloaded public functions
     blRoiIterator<blBufferType,blBufferPtr>                 operator+(const int& movement)const;
     blRoiIterator<blBufferType,blBufferPtr>                 operator-(const int& movement)const;
 
+    std::ptrdiff_t                                          operator-(const blRoiIterator<blBufferType,blBufferPtr>& roiIterator)const;
+
 
 
     // Function used to get the actual
@@ -215,6 +234,34 @@ protected: // Protected functions
     // to this instant
 
     void                                                    updateCurrentNumberOfCirculations();
+
+
+
+    // Functions used to find the contiguous
+    // run of the ROI the iterator is in and
+    // to get the pointer to the indexed data
+    // point from the run (finding the run
+    // again only when the iterator left it)
+
+    void                                                    updateCurrentRun()const;
+
+    blDataPtr                                               getPointerWithinCurrentRun()const;
+
+
+
+protected: // Protected variables
+
+
+
+    // The run the iterator was last found
+    // in, given as the pointer to the run's
+    // first data point and the range of
+    // (non-wrapped) data indexes it covers
+
+    mutable blDataPtr                                       m_runPointer = blDataPtr(nullptr);
+
+    mutable std::ptrdiff_t                                  m_runBeginIndex = 0;
+    mutable std::ptrdiff_t                                  m_runEndIndex = 0;
 };
 //-------------------------------------------------------------------
 
@@ -234,16 +281,6 @@ inline blRoiIterator<blBufferType,blBufferPtr>::blRoiIterator(const blBufferPtr&
                                                                                                              maxNumberOfCirculations)
 {
 }
-
-
-
-template<typename blBufferType,
-         typename blBufferPtr>
-
-inline blRoiIterator<blBufferType,blBufferPtr>::blRoiIterator(const blRoiIterator<blBufferType,blBufferPtr>& roiIterator)
-                                                              : blCircularIterator<blBufferType,blBufferPtr>(roiIterator)
-{
-}
 //-------------------------------------------------------------------
 
 
@@ -295,7 +332,62 @@ template<typename blBufferType,
 
 inline void blRoiIterator<blBufferType,blBufferPtr>::updateCurrentNumberOfCirculations()
 {
-    this->m_currentNumberOfCirculations = (this->m_dataIndex - this->m_startIndex) / std::ptrdiff_t(this->m_bufferPtr->roi().size());
+    // The ROI iterator laps around the
+    // ROI rather than the whole buffer
+
+    if(this->m_dataIndex >= this->m_lapBeginIndex &&
+       this->m_dataIndex < this->m_lapEndIndex &&
+       this->m_startIndex == this->m_lapStartIndex)
+    {
+        return;
+    }
+
+    if(!this->m_bufferPtr)
+        return;
+
+    this->updateCurrentLap(std::ptrdiff_t(this->m_bufferPtr->roi().size()));
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to find the contiguous
+// run the iterator is in and to get the
+// pointer to the indexed data point
+//-------------------------------------------------------------------
+template<typename blBufferType,
+         typename blBufferPtr>
+
+inline void blRoiIterator<blBufferType,blBufferPtr>::updateCurrentRun()const
+{
+    // The run length divides the ROI's
+    // size, so a run never straddles the
+    // point where the ROI wraps around
+
+    std::size_t runLength = this->m_bufferPtr->roiRunLength();
+
+    std::ptrdiff_t positionInRoi = static_cast<std::ptrdiff_t>(this->circ_index(this->m_dataIndex,this->m_bufferPtr->roi().size()));
+
+    std::ptrdiff_t positionInRun = positionInRoi % static_cast<std::ptrdiff_t>(runLength);
+
+    m_runBeginIndex = this->m_dataIndex - positionInRun;
+    m_runEndIndex = m_runBeginIndex + static_cast<std::ptrdiff_t>(runLength);
+
+    m_runPointer = blDataPtr(&this->m_bufferPtr->roi_at(positionInRoi - positionInRun));
+}
+
+
+
+template<typename blBufferType,
+         typename blBufferPtr>
+
+inline typename blRoiIterator<blBufferType,blBufferPtr>::blDataPtr blRoiIterator<blBufferType,blBufferPtr>::getPointerWithinCurrentRun()const
+{
+    if(this->m_dataIndex < m_runBeginIndex || this->m_dataIndex >= m_runEndIndex)
+        this->updateCurrentRun();
+
+    return m_runPointer + (this->m_dataIndex - m_runBeginIndex);
 }
 //-------------------------------------------------------------------
 
@@ -330,7 +422,13 @@ template<typename blBufferType,
 
 inline std::size_t blRoiIterator<blBufferType,blBufferPtr>::remainingContiguousSpots()const
 {
-    return this->m_bufferPtr->roi().size() - this->circ_index(this->m_dataIndex,this->m_bufferPtr->roi().size());
+    // Only the rest of the current
+    // run is contiguous in memory
+
+    if(this->m_dataIndex < m_runBeginIndex || this->m_dataIndex >= m_runEndIndex)
+        this->updateCurrentRun();
+
+    return static_cast<std::size_t>(m_runEndIndex - this->m_dataIndex);
 }
 
 
@@ -340,7 +438,7 @@ template<typename blBufferType,
 
 inline std::size_t blRoiIterator<blBufferType,blBufferPtr>::remainingContiguousBytes()const
 {
-    return sizeof(blDataType) * (this->m_bufferPtr->roi().size() - circ_index(this->m_dataIndex,this->m_bufferPtr->roi().size()));
+    return sizeof(blDataType) * this->remainingContiguousSpots();
 }
 //-------------------------------------------------------------------
 
@@ -453,7 +551,7 @@ inline typename blRoiIterator<blBufferType,blBufferPtr>::blDataType& blRoiIterat
     if(this->hasReachedEndOfBuffer())
         return this->m_bufferPtr->roi_at(this->m_bufferPtr->roi().size());
 
-    return this->m_bufferPtr->roi_at(this->circ_index(this->m_dataIndex,this->m_bufferPtr->roi().size()));
+    return *this->getPointerWithinCurrentRun();
 }
 
 
@@ -474,7 +572,7 @@ inline const typename blRoiIterator<blBufferType,blBufferPtr>::blDataType& blRoi
     if(this->hasReachedEndOfBuffer())
         return this->m_bufferPtr->roi_at(this->m_bufferPtr->roi().size());
 
-    return this->m_bufferPtr->roi_at(this->circ_index(this->m_dataIndex,this->m_bufferPtr->roi().size()));
+    return *this->getPointerWithinCurrentRun();
 }
 
 
@@ -498,7 +596,7 @@ inline typename blRoiIterator<blBufferType,blBufferPtr>::blDataPtr blRoiIterator
     if(this->hasReachedEndOfBuffer())
         return blDataPtr(&this->m_bufferPtr->roi_at(this->m_bufferPtr->roi().size()));
 
-    return blDataPtr(&this->m_bufferPtr->roi_at(this->circ_index(this->m_dataIndex,this->m_bufferPtr->roi().size())));
+    return this->getPointerWithinCurrentRun();
 }
 
 
@@ -522,7 +620,7 @@ inline const typename blRoiIterator<blBufferType,blBufferPtr>::blDataPtr blRoiIt
     if(this->hasReachedEndOfBuffer())
         return blDataPtr(&this->m_bufferPtr->roi_at(this->m_bufferPtr->roi().size()));
 
-    return blDataPtr(&this->m_bufferPtr->roi_at(this->circ_index(this->m_dataIndex,this->m_bufferPtr->roi().size())));
+    return this->getPointerWithinCurrentRun();
 }
 //-------------------------------------------------------------------
 
@@ -644,6 +742,16 @@ inline blRoiIterator<blBufferType,blBufferPtr> blRoiIterator<blBufferType,blBuff
 
     return temp;
 }
+
+
+
+template<typename blBufferType,
+         typename blBufferPtr>
+
+inline std::ptrdiff_t blRoiIterator<blBufferType,blBufferPtr>::operator-(const blRoiIterator<blBufferType,blBufferPtr>& roiIterator)const
+{
+    return ( this->m_dataIndex - roiIterator.getDataIndex() );
+}
 //-------------------------------------------------------------------
 
 
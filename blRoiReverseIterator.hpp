@@ -79,9 +79,12 @@ public: // Constructors and destructors
 
 
 
-    // Copy constructor
+    // Copy constructor and
+    // assignment operator
 
-    blRoiReverseIterator(const blRoiReverseIterator<blBufferType,blBufferPtr>& roiReverseIterator);
+    blRoiReverseIterator(const blRoiReverseIterator<blBufferType,blBufferPtr>& roiReverseIterator) = default;
+
+    blRoiReverseIterator<blBufferType,blBufferPtr>& operator=(const blRoiReverseIterator<blBufferType,blBufferPtr>& roiReverseIterator) = default;
 
 
 
@@ -180,16 +183,6 @@ inline blRoiReverseIterator<blBufferType,blBufferPtr>::blRoiReverseIterator(cons
         this->setDataIndex(bufferPtr->roi().size() - 1 - dataIndex);
     }
 }
-
-
-
-template<typename blBufferType,
-         typename blBufferPtr>
-
-inline blRoiReverseIterator<blBufferType,blBufferPtr>::blRoiReverseIterator(const blRoiReverseIterator<blBufferType,blBufferPtr>& roiIterator)
-                                                                            : blRoiIterator<blBufferType,blBufferPtr>(roiIterator)
-{
-}
 //-------------------------------------------------------------------
 
 
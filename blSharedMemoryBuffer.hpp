@@ -17,6 +17,28 @@
 //                     can create the data on a user specified shared
 //                     memory location
 //
+//                  -- Next to the data, the "create" functions also
+//                     find or construct the buffer's control block
+//                     (the write sequences, the writers flag, the wait
+//                     strategies and the readers' cursors) in the same
+//                     shared memory segment, so that writers and readers
+//                     in different processes share one ring, with the
+//                     same lock-free semantics as threads in one process
+//
+//                     -- Reader ids are shared by all processes, so each
+//                        reader process should use its own ids
+//
+//                     -- The data lives in a boost::interprocess vector,
+//                        so these buffers cannot be mirrored, use
+//                        blPosixSharedMemoryBuffer for mirrored rings
+//
+//                     -- Boost maps the segment itself, so explicit huge
+//                        pages are not available either, but the segment
+//                        can be advised to use transparent huge pages with
+//                        blMappedMemory::adviseTransparentHugePages(segment.get_address(),
+//                                                                  segment.get_size(),
+//                                                                  true)
+//
 //                  -- The specialized template and all its type
 //                     alieases are defined within the blBufferLIB
 //                     namespace
@@ -97,7 +119,7 @@ template<typename blDataType,
          std::size_t blMaxNumOfDimensions,
          typename blDataPtr = bsip::offset_ptr<blDataType> >
 
-using blSharedBufferPtrType = bsip::offset_ptr< blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions> >;
+using blSharedBufferPtrType = bsip::offset_ptr< blBuffer_2<blDataType,blDataPtr,blMaxNumOfDimensions,blAlignedAllocator<blDataType> > >;
 
 
 
@@ -108,7 +130,7 @@ template<typename blDataType,
          typename blDataPtr = bsip::offset_ptr<blDataType>,
          typename blBufferPtr = blSharedBufferPtrType<blDataType,blMaxNumOfDimensions,blDataPtr> >
 
-using blSharedBufferRoiPtrType = bsip::offset_ptr< blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions> >;
+using blSharedBufferRoiPtrType = bsip::offset_ptr< blBuffer_4<blDataType,blDataPtr,blBufferPtr,blMaxNumOfDimensions,blAlignedAllocator<blDataType> > >;
 //-------------------------------------------------------------------
 
 
@@ -180,6 +202,11 @@ public: // Overloaded Create functions used to
     // -- These function overload the base functions
     //    allocating memory in a shared memory segment
     //    as opposed to its own internal memory
+    //
+    // -- The control block shared by all the
+    //    buffers using the same data vector is
+    //    named after the data vector, with the
+    //    "_controlBlock" suffix
 
     template<typename...blIntegerType>
     bool                                                                    create(bsip::managed_shared_memory& sharedMemorySegment,
@@ -346,6 +373,13 @@ template<typename blDataType,
 inline bool blSharedMemoryBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBufferPtr,blBufferRoiPtr>::create(bsip::managed_shared_memory& sharedMemorySegment,
                                                                                                                const std::string& nameOfDataVector)
 {
+    // We pad the buffer's dimensions
+    // if we were asked to
+
+    this->applyPitchAlignments();
+
+
+
     // First we create an instance of
     // the shared memory allocator
 
@@ -398,10 +432,37 @@ inline bool blSharedMemoryBuffer<blDataType,blMaxNumOfDimensions,blDataPtr,blBuf
         // resized data vector with
         // this buffer
 
+        this->unlockData();
+
         this->wrap((*newDataVectorPointer)[0]);
 
 
 
+        // We then find or construct the
+        // control block shared by all the
+        // processes using this buffer, so
+        // that they all see the same write
+        // sequence and readers
+
+        std::string nameOfControlBlock = nameOfDataVector + "_controlBlock";
+
+        auto controlBlockPointer = sharedMemorySegment.find_or_construct<blRingControlBlock>(nameOfControlBlock.c_str())();
+
+        if(!controlBlockPointer)
+            return false;
+
+        this->setControlBlock(controlBlockPointer);
+
+
+
+        // The data might already be in use
+        // by other processes, so it's only
+        // read from while prefaulting
+
+        this->prefaultAndLockData(false);
+
+
+
         // Let's not forget to let
         // the user know whether the
         // resizing was successful
@@ -0,0 +1,180 @@
+#ifndef BL_SPAN_HPP
+#define BL_SPAN_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blSpan.hpp
+// CLASS:           blSpan
+//                  blSpanPair
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         -- The blSpan class is a very simple non-owning
+//                     view of a contiguous piece of memory, defined
+//                     by a pointer to its first data point and the
+//                     number of data points in it
+//
+//                  -- The blSpanPair class holds two spans, used to
+//                     describe a region of a circular buffer, where
+//                     the first span covers the region up to the end
+//                     of the buffer and the second span covers the
+//                     part of the region that wrapped around to the
+//                     beginning of the buffer (the second span is
+//                     empty when the region does not wrap around)
+//
+//                  -- These classes are defined within the namespace "blBufferLIB"
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- C++17
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+#include <cstddef>
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blSpan declaration
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blSpan
+{
+public: // Public type aliases
+
+
+
+    using value_type = blDataType;
+    using pointer = blDataType*;
+    using reference = blDataType&;
+    using iterator = blDataType*;
+
+
+
+public: // Constructors and destructors
+
+
+
+    // Default constructor
+
+    blSpan() = default;
+
+
+
+    // Constructor from a pointer
+    // and a number of data points
+
+    blSpan(blDataType* data,const std::size_t& size) : m_data(data),m_size(size)
+    {
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Functions used to get the
+    // pointer to the data and the
+    // number of data points
+
+    blDataType*                                             data()const{return m_data;}
+    const std::size_t&                                      size()const{return m_size;}
+    std::size_t                                             size_in_bytes()const{return m_size * sizeof(blDataType);}
+    bool                                                    empty()const{return m_size == 0;}
+
+
+
+    // Iterators and access operator
+
+    blDataType*                                             begin()const{return m_data;}
+    blDataType*                                             end()const{return m_data + m_size;}
+
+    blDataType&                                             operator[](const std::size_t& dataIndex)const{return m_data[dataIndex];}
+
+
+
+private: // Private variables
+
+
+
+    // Pointer to the first data point
+    // and number of data points
+
+    blDataType*                                             m_data = nullptr;
+    std::size_t                                             m_size = 0;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blSpanPair declaration
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blSpanPair
+{
+public: // Public variables
+
+
+
+    // The span up to the end of the
+    // buffer and the span that wrapped
+    // around to its beginning
+
+    blSpan<blDataType>                                      m_first;
+    blSpan<blDataType>                                      m_second;
+
+
+
+public: // Public functions
+
+
+
+    // Function used to get the total
+    // number of data points in both spans
+
+    std::size_t                                             size()const{return m_first.size() + m_second.size();}
+    bool                                                    empty()const{return size() == 0;}
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_SPAN_HPP
@@ -0,0 +1,797 @@
+#ifndef BL_WAITSTRATEGY_HPP
+#define BL_WAITSTRATEGY_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blWaitStrategy.hpp
+// CLASS:           blWaitStrategy
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         -- This class defines the policy used by a thread
+//                     that has to wait for some condition to become
+//                     true, for example a writer waiting for its turn
+//                     to write to a buffer
+//
+//                  -- The available strategies are:
+//
+//                     -- BUSY_SPIN: The thread keeps checking the
+//                                   condition, issuing a cpu "pause"
+//                                   instruction between checks
+//
+//                     -- SPIN_THEN_YIELD: The thread spins for a bounded
+//                                         number of checks and then keeps
+//                                         yielding its time slice to other
+//                                         threads (sched_yield)
+//
+//                     -- SPIN_YIELD_THEN_PARK: The thread spins, then yields
+//                                              and then parks itself on a
+//                                              futex, until another thread
+//                                              calls the "notify" function
+//
+//                  -- The "waitUntil" function bounds the wait with a
+//                     deadline and tells whether the condition became
+//                     true or the wait timed out
+//
+//                  -- The "notify" function only does any work (a futex
+//                     wake syscall) when using the parking strategy and
+//                     only if there actually are parked threads, so the
+//                     notifying thread does not pay for a strategy it's
+//                     not using, and it never issues a full fence
+//
+//                  -- Because the notifying thread doesn't fence, it can
+//                     miss a thread that parks right as it notifies, so
+//                     parked threads never sleep longer than a short
+//                     interval ("maxParkTime") before checking their
+//                     condition again
+//
+//                  -- The class also keeps counters of how many times
+//                     threads had to wait and how long they waited
+//
+//                  -- This class is defined within the namespace "blBufferLIB"
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+//
+//
+// DEPENDENCIES:    -- C++17
+//
+//                  -- On linux the parking strategy uses futexes, on
+//                     other systems parked threads sleep for short
+//                     intervals instead
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+// Used for the atomic counters
+// and the futex word
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+
+
+// Used to yield/sleep and to
+// measure the time spent waiting
+
+#include <thread>
+#include <chrono>
+#include <algorithm>
+
+
+
+// Used for the cpu "pause" instruction
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+
+
+// Used to park threads on a futex
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#endif
+
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blBufferLIB namespace
+//-------------------------------------------------------------------
+namespace blBufferLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Enumeration of the available wait strategies
+//-------------------------------------------------------------------
+enum class blWaitStrategyType
+{
+    BUSY_SPIN,
+    SPIN_THEN_YIELD,
+    SPIN_YIELD_THEN_PARK
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Structure used to report how much
+// time threads spent waiting
+//-------------------------------------------------------------------
+struct blWaitStatistics
+{
+    // Number of times a thread had to
+    // wait because the condition was
+    // not true right away
+
+    std::uint64_t                                           m_numberOfWaits = 0;
+
+
+
+    // Number of times a thread had
+    // to be parked (put to sleep)
+
+    std::uint64_t                                           m_numberOfParks = 0;
+
+
+
+    // Total and maximum time spent
+    // waiting, in nanoseconds
+
+    std::uint64_t                                           m_totalWaitTimeInNanoseconds = 0;
+    std::uint64_t                                           m_maxWaitTimeInNanoseconds = 0;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// class blWaitStrategy declaration
+//-------------------------------------------------------------------
+class blWaitStrategy
+{
+public: // Constructors and destructors
+
+
+
+    // Default constructor
+
+    blWaitStrategy();
+
+
+
+    // Copy constructor
+    //
+    // NOTE: Only the configuration is
+    //       copied, the counters and the
+    //       parked threads are not
+
+    blWaitStrategy(const blWaitStrategy& waitStrategy);
+
+
+
+    // Destructor
+
+    ~blWaitStrategy();
+
+
+
+public: // Overloaded operators
+
+
+
+    // Assignment operator
+    //
+    // NOTE: Only the configuration is
+    //       copied, the counters and the
+    //       parked threads are not
+
+    blWaitStrategy&                                         operator=(const blWaitStrategy& waitStrategy);
+
+
+
+public: // Public functions
+
+
+
+    // Functions used to get/set
+    // the wait strategy type
+
+    const blWaitStrategyType&                               type()const;
+    void                                                    setType(const blWaitStrategyType& type);
+
+
+
+    // Functions used to get/set the
+    // number of checks a thread spins
+    // for and then yields for before
+    // moving on to the next phase
+
+    const std::size_t&                                      spinLimit()const;
+    const std::size_t&                                      yieldLimit()const;
+
+    void                                                    setSpinLimit(const std::size_t& spinLimit);
+    void                                                    setYieldLimit(const std::size_t& yieldLimit);
+
+
+
+    // This function waits until the
+    // specified predicate returns true
+    //
+    // NOTE: The predicate is allowed to
+    //       have side effects, for example
+    //       a "try to acquire" operation,
+    //       and is called until it succeeds
+
+    template<typename blPredicateType>
+    void                                                    wait(blPredicateType predicate);
+
+
+
+    // This function waits until the
+    // specified predicate returns true
+    // or the specified deadline expires,
+    // returning false in case of timeout
+
+    template<typename blPredicateType>
+    bool                                                    waitUntil(blPredicateType predicate,
+                                                                      const std::chrono::steady_clock::time_point& deadline);
+
+
+
+    // This function has to be called by
+    // the thread that changes the condition
+    // other threads are waiting on, right
+    // after changing it, so that parked
+    // threads can be woken up
+
+    void                                                    notify();
+
+
+
+    // Functions used to get/reset
+    // the wait statistics
+
+    blWaitStatistics                                        statistics()const;
+    void                                                    resetStatistics();
+
+
+
+    // Function used to issue the
+    // cpu "pause" instruction, used
+    // between checks when spinning
+
+    static void                                             cpuRelax();
+
+
+
+public: // Public variables
+
+    // The longest time a thread stays
+    // parked before checking its condition
+    // again, which bounds the delay when
+    // a notification misses the thread
+    // right as it parks
+
+    static constexpr std::chrono::microseconds              maxParkTime{1000};
+
+
+
+protected: // Protected functions
+
+
+
+    // Functions used to park a thread
+    // on the futex word while it still
+    // holds the expected value (at most
+    // until the specified deadline), and
+    // to wake up all parked threads
+
+    void                                                    park(const std::uint32_t& expectedValue,
+                                                                 const std::chrono::steady_clock::time_point& deadline);
+    void                                                    wakeAll();
+
+
+
+    // Function used to record
+    // a completed wait
+
+    void                                                    recordWait(const std::chrono::steady_clock::time_point& startTime,
+                                                                       const bool& wasThreadParked);
+
+
+
+protected: // Protected variables
+
+
+
+    // The wait strategy type
+    // and its spin/yield limits
+
+    blWaitStrategyType                                      m_type;
+
+    std::size_t                                             m_spinLimit;
+    std::size_t                                             m_yieldLimit;
+
+
+
+    // The futex word, which gets
+    // bumped every time parked
+    // threads are woken up, and
+    // the number of parked threads
+
+    std::atomic<std::uint32_t>                              m_wakeUpSequence;
+    std::atomic<std::uint32_t>                              m_numberOfParkedThreads;
+
+
+
+    // The wait counters
+
+    std::atomic<std::uint64_t>                              m_numberOfWaits;
+    std::atomic<std::uint64_t>                              m_numberOfParks;
+    std::atomic<std::uint64_t>                              m_totalWaitTimeInNanoseconds;
+    std::atomic<std::uint64_t>                              m_maxWaitTimeInNanoseconds;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Default constructor
+//-------------------------------------------------------------------
+inline blWaitStrategy::blWaitStrategy()
+{
+    // By default we spin for a little
+    // while, then yield and then park
+
+    m_type = blWaitStrategyType::SPIN_YIELD_THEN_PARK;
+
+    m_spinLimit = 128;
+    m_yieldLimit = 16;
+
+    m_wakeUpSequence = 0;
+    m_numberOfParkedThreads = 0;
+
+    resetStatistics();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+inline blWaitStrategy::blWaitStrategy(const blWaitStrategy& waitStrategy) : blWaitStrategy()
+{
+    (*this) = waitStrategy;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+inline blWaitStrategy::~blWaitStrategy()
+{
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+inline blWaitStrategy& blWaitStrategy::operator=(const blWaitStrategy& waitStrategy)
+{
+    m_type = waitStrategy.type();
+
+    m_spinLimit = waitStrategy.spinLimit();
+    m_yieldLimit = waitStrategy.yieldLimit();
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the wait strategy type
+//-------------------------------------------------------------------
+inline const blWaitStrategyType& blWaitStrategy::type()const
+{
+    return m_type;
+}
+
+
+
+inline void blWaitStrategy::setType(const blWaitStrategyType& type)
+{
+    m_type = type;
+
+
+
+    // In case we're switching away from
+    // parking, we make sure no thread
+    // is left parked
+
+    wakeAll();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the spin/yield limits
+//-------------------------------------------------------------------
+inline const std::size_t& blWaitStrategy::spinLimit()const
+{
+    return m_spinLimit;
+}
+
+
+
+inline const std::size_t& blWaitStrategy::yieldLimit()const
+{
+    return m_yieldLimit;
+}
+
+
+
+inline void blWaitStrategy::setSpinLimit(const std::size_t& spinLimit)
+{
+    m_spinLimit = spinLimit;
+}
+
+
+
+inline void blWaitStrategy::setYieldLimit(const std::size_t& yieldLimit)
+{
+    m_yieldLimit = yieldLimit;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to issue the cpu "pause" instruction
+//-------------------------------------------------------------------
+inline void blWaitStrategy::cpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// These functions wait until the specified predicate
+// returns true (or until the specified deadline)
+//-------------------------------------------------------------------
+template<typename blPredicateType>
+
+inline void blWaitStrategy::wait(blPredicateType predicate)
+{
+    waitUntil(predicate,std::chrono::steady_clock::time_point::max());
+}
+
+
+
+template<typename blPredicateType>
+
+inline bool blWaitStrategy::waitUntil(blPredicateType predicate,
+                                      const std::chrono::steady_clock::time_point& deadline)
+{
+    // In the common case the condition
+    // is already true and we don't even
+    // bother timing anything
+
+    if(predicate())
+        return true;
+
+
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    bool hasDeadline = (deadline != std::chrono::steady_clock::time_point::max());
+
+
+
+    // First we spin, pausing the
+    // cpu between checks so that
+    // we don't starve a hyper-threaded
+    // sibling
+
+    for(std::size_t i = 0; m_type == blWaitStrategyType::BUSY_SPIN || i < m_spinLimit; ++i)
+    {
+        cpuRelax();
+
+        if(predicate())
+        {
+            recordWait(startTime,false);
+            return true;
+        }
+
+        if(hasDeadline && std::chrono::steady_clock::now() >= deadline)
+        {
+            recordWait(startTime,false);
+            return false;
+        }
+    }
+
+
+
+    // Then we yield our time
+    // slice to other threads
+
+    for(std::size_t i = 0; m_type == blWaitStrategyType::SPIN_THEN_YIELD || i < m_yieldLimit; ++i)
+    {
+        std::this_thread::yield();
+
+        if(predicate())
+        {
+            recordWait(startTime,false);
+            return true;
+        }
+
+        if(hasDeadline && std::chrono::steady_clock::now() >= deadline)
+        {
+            recordWait(startTime,false);
+            return false;
+        }
+    }
+
+
+
+    // Finally we park ourselves until
+    // another thread notifies us
+    //
+    // NOTE: We read the futex word before
+    //       announcing that we're parked and
+    //       checking the condition one last
+    //       time, so if the notifying thread
+    //       sees us parked it bumps the futex
+    //       word, which makes the park return
+    //       right away
+    //
+    // NOTE: The notifying thread doesn't
+    //       fence before checking for parked
+    //       threads (so that it doesn't pay a
+    //       full barrier on every notify), so
+    //       it can miss us while we park, which
+    //       is why we never park for longer than
+    //       "maxParkTime" at a time
+
+    while(true)
+    {
+        std::uint32_t wakeUpSequence = m_wakeUpSequence.load(std::memory_order_acquire);
+
+        m_numberOfParkedThreads.fetch_add(1,std::memory_order_seq_cst);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if(predicate())
+        {
+            m_numberOfParkedThreads.fetch_sub(1,std::memory_order_relaxed);
+
+            recordWait(startTime,true);
+            return true;
+        }
+
+        park(wakeUpSequence,std::min(deadline,std::chrono::steady_clock::now() + maxParkTime));
+
+        m_numberOfParkedThreads.fetch_sub(1,std::memory_order_relaxed);
+
+        if(predicate())
+        {
+            recordWait(startTime,true);
+            return true;
+        }
+
+        if(hasDeadline && std::chrono::steady_clock::now() >= deadline)
+        {
+            recordWait(startTime,true);
+            return false;
+        }
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// This function wakes up parked threads
+//-------------------------------------------------------------------
+inline void blWaitStrategy::notify()
+{
+    // Only the parking strategy
+    // ever needs to be notified
+
+    if(m_type != blWaitStrategyType::SPIN_YIELD_THEN_PARK)
+        return;
+
+
+
+    // A relaxed check is enough here,
+    // a parked thread we miss because
+    // our change is still on its way
+    // wakes up by itself within
+    // "maxParkTime" and sees it
+
+    if(m_numberOfParkedThreads.load(std::memory_order_relaxed) == 0)
+        return;
+
+    wakeAll();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to park and wake up threads
+//-------------------------------------------------------------------
+inline void blWaitStrategy::park(const std::uint32_t& expectedValue,
+                                 const std::chrono::steady_clock::time_point& deadline)
+{
+#if defined(__linux__)
+
+    // We use a non-private futex so
+    // that it also works when the
+    // futex word is shared between
+    // processes, and we turn the
+    // deadline into a relative timeout
+
+    struct timespec timeout;
+    struct timespec* timeoutPtr = nullptr;
+
+    if(deadline != std::chrono::steady_clock::time_point::max())
+    {
+        auto timeLeft = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now()).count();
+
+        if(timeLeft <= 0)
+            return;
+
+        timeout.tv_sec = static_cast<time_t>(timeLeft / 1000000000);
+        timeout.tv_nsec = static_cast<long>(timeLeft % 1000000000);
+
+        timeoutPtr = &timeout;
+    }
+
+    syscall(SYS_futex,
+            reinterpret_cast<std::uint32_t*>(&m_wakeUpSequence),
+            FUTEX_WAIT,
+            expectedValue,
+            timeoutPtr,
+            nullptr,
+            0);
+
+#else
+
+    // Without futexes we just
+    // sleep for a short while
+
+    if(m_wakeUpSequence.load(std::memory_order_acquire) == expectedValue &&
+       std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+
+#endif
+}
+
+
+
+inline void blWaitStrategy::wakeAll()
+{
+    m_wakeUpSequence.fetch_add(1,std::memory_order_release);
+
+#if defined(__linux__)
+
+    syscall(SYS_futex,
+            reinterpret_cast<std::uint32_t*>(&m_wakeUpSequence),
+            FUTEX_WAKE,
+            INT32_MAX,
+            nullptr,
+            nullptr,
+            0);
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to record/get/reset the wait statistics
+//-------------------------------------------------------------------
+inline void blWaitStrategy::recordWait(const std::chrono::steady_clock::time_point& startTime,
+                                       const bool& wasThreadParked)
+{
+    auto waitTimeInNanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+
+
+
+    m_numberOfWaits.fetch_add(1,std::memory_order_relaxed);
+
+    if(wasThreadParked)
+        m_numberOfParks.fetch_add(1,std::memory_order_relaxed);
+
+    m_totalWaitTimeInNanoseconds.fetch_add(waitTimeInNanoseconds,std::memory_order_relaxed);
+
+
+
+    // We only update the maximum
+    // if our wait was actually longer
+
+    std::uint64_t maxWaitTimeInNanoseconds = m_maxWaitTimeInNanoseconds.load(std::memory_order_relaxed);
+
+    while(waitTimeInNanoseconds > maxWaitTimeInNanoseconds &&
+          !m_maxWaitTimeInNanoseconds.compare_exchange_weak(maxWaitTimeInNanoseconds,
+                                                            waitTimeInNanoseconds,
+                                                            std::memory_order_relaxed))
+    {
+    }
+}
+
+
+
+inline blWaitStatistics blWaitStrategy::statistics()const
+{
+    blWaitStatistics waitStatistics;
+
+    waitStatistics.m_numberOfWaits = m_numberOfWaits.load(std::memory_order_relaxed);
+    waitStatistics.m_numberOfParks = m_numberOfParks.load(std::memory_order_relaxed);
+    waitStatistics.m_totalWaitTimeInNanoseconds = m_totalWaitTimeInNanoseconds.load(std::memory_order_relaxed);
+    waitStatistics.m_maxWaitTimeInNanoseconds = m_maxWaitTimeInNanoseconds.load(std::memory_order_relaxed);
+
+    return waitStatistics;
+}
+
+
+
+inline void blWaitStrategy::resetStatistics()
+{
+    m_numberOfWaits = 0;
+    m_numberOfParks = 0;
+    m_totalWaitTimeInNanoseconds = 0;
+    m_maxWaitTimeInNanoseconds = 0;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_WAITSTRATEGY_HPP